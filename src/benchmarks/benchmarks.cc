@@ -0,0 +1,203 @@
+#include <benchmark/benchmark.h>
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+
+#include "../graph/graph.h"
+#include "../graph/graph_algorithms.h"
+
+// Graphs are named by order and the percentage of vertex pairs joined by an
+// edge. Every graph also contains a ring through all vertices, so it is
+// connected and has a tour; weights are 1 to 100. Wall-clock time is measured
+// because several engines run on a thread pool.
+
+namespace {
+
+using s21::GraphAlgorithms;
+
+s21::Graph MakeGraph(size_t order, int density, bool symmetric = false) {
+  std::mt19937 gen(static_cast<unsigned>(order * 101 + density));
+  std::uniform_int_distribution<> percent(0, 99);
+  std::uniform_int_distribution<> weight(1, 100);
+  s21::Matrix<int> m(order, order);
+  for (size_t i = 0; i < order; i++) {
+    for (size_t j = symmetric ? i + 1 : 0; j < order; j++) {
+      if (i != j && percent(gen) < density) {
+        m(i, j) = weight(gen);
+        if (symmetric) m(j, i) = m(i, j);
+      }
+    }
+  }
+  for (size_t i = 0; i < order; i++) {
+    size_t next = (i + 1) % order;
+    if (!m(i, next)) m(i, next) = weight(gen);
+    if (!m(next, i)) m(next, i) = m(i, next);
+  }
+  return s21::Graph(std::move(m));
+}
+
+void SetGraphCounters(benchmark::State& state, const s21::Graph& graph) {
+  state.counters["vertices"] = graph.order();
+  state.counters["density"] = state.range(1);
+}
+
+void BM_LoadGraphFromFile(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), state.range(1));
+  std::string path =
+      (std::filesystem::temp_directory_path() / "s21_bench_graph.txt")
+          .string();
+  {
+    std::ofstream file(path);
+    file << graph.order() << '\n';
+    for (size_t i = 0; i < graph.order(); i++) {
+      for (size_t j = 0; j < graph.order(); j++) {
+        file << graph.adjacency_matrix()(i, j) << ' ';
+      }
+      file << '\n';
+    }
+  }
+  s21::Graph loaded;
+  for (auto _ : state) {
+    loaded.LoadGraphFromFile(path);
+  }
+  std::filesystem::remove(path);
+  SetGraphCounters(state, graph);
+}
+
+void BM_DepthFirstSearch(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(GraphAlgorithms::DepthFirstSearch(graph, 0));
+  }
+  SetGraphCounters(state, graph);
+}
+
+void BM_BreadthFirstSearch(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(GraphAlgorithms::BreadthFirstSearch(graph, 0));
+  }
+  SetGraphCounters(state, graph);
+}
+
+// GetShortestPathsFromVertex picks its queue by the weights; with weights up
+// to 100 it runs Dial's bucket queue. The shortest-path tree cache is cleared
+// every iteration, so each query runs a full search.
+void BM_SingleSourceShortestPaths(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), state.range(1));
+  for (auto _ : state) {
+    GraphAlgorithms::path_cache().Clear();
+    benchmark::DoNotOptimize(
+        GraphAlgorithms::GetShortestPathsFromVertex(graph, 0));
+  }
+  SetGraphCounters(state, graph);
+}
+
+void BM_BellmanFord(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(GraphAlgorithms::FordBellmanAlgorithm(graph, 0));
+  }
+  SetGraphCounters(state, graph);
+}
+
+template <GraphAlgorithms::ApspEngine engine>
+void BM_AllPairs(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), state.range(1));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        GraphAlgorithms::GetShortestPathsBetweenAllVertices(graph, 0, engine));
+  }
+  SetGraphCounters(state, graph);
+}
+
+void BM_LeastSpanningTree(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), state.range(1), true);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(GraphAlgorithms::GetLeastSpanningTreeEdges(graph));
+  }
+  SetGraphCounters(state, graph);
+}
+
+template <GraphAlgorithms::MstEngine engine>
+void BM_MinimumSpanningForest(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), state.range(1), true);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        GraphAlgorithms::GetMinimumSpanningForest(graph, 0, engine));
+  }
+  SetGraphCounters(state, graph);
+}
+
+// Complete symmetric graphs with a fixed seed. The tour length is reported
+// so that engine choices can be compared on quality as well as time.
+template <GraphAlgorithms::TspEngine engine>
+void BM_TravelingSalesman(benchmark::State& state) {
+  s21::Graph graph = MakeGraph(state.range(0), 100, true);
+  double distance = 0.0;
+  for (auto _ : state) {
+    distance =
+        GraphAlgorithms::SolveTravelingSalesmanProblem(graph, 1, 0, engine)
+            .distance;
+  }
+  state.counters["vertices"] = graph.order();
+  state.counters["distance"] = distance;
+}
+
+void GraphSizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->UseRealTime();
+  for (int order : {64, 256, 1024}) {
+    for (int density : {5, 50, 100}) {
+      benchmark->Args({order, density});
+    }
+  }
+}
+
+// For the cubic algorithms.
+void SmallGraphSizes(benchmark::internal::Benchmark* benchmark) {
+  benchmark->UseRealTime();
+  for (int order : {64, 256}) {
+    for (int density : {5, 50, 100}) {
+      benchmark->Args({order, density});
+    }
+  }
+}
+
+}  // namespace
+
+using Apsp = GraphAlgorithms::ApspEngine;
+using Mst = GraphAlgorithms::MstEngine;
+using Tsp = GraphAlgorithms::TspEngine;
+
+BENCHMARK(BM_LoadGraphFromFile)->Apply(GraphSizes);
+BENCHMARK(BM_DepthFirstSearch)->Apply(GraphSizes);
+BENCHMARK(BM_BreadthFirstSearch)->Apply(GraphSizes);
+BENCHMARK(BM_SingleSourceShortestPaths)->Apply(GraphSizes);
+BENCHMARK(BM_BellmanFord)->Apply(SmallGraphSizes);
+BENCHMARK(BM_AllPairs<Apsp::kFloyd>)->Apply(SmallGraphSizes);
+BENCHMARK(BM_AllPairs<Apsp::kJohnson>)->Apply(SmallGraphSizes);
+BENCHMARK(BM_LeastSpanningTree)->Apply(GraphSizes);
+BENCHMARK(BM_MinimumSpanningForest<Mst::kBoruvka>)->Apply(GraphSizes);
+BENCHMARK(BM_MinimumSpanningForest<Mst::kFilterKruskal>)->Apply(GraphSizes);
+BENCHMARK(BM_TravelingSalesman<Tsp::kHeldKarp>)
+    ->UseRealTime()
+    ->Arg(12)
+    ->Arg(16);
+BENCHMARK(BM_TravelingSalesman<Tsp::kBranchAndBound>)
+    ->UseRealTime()
+    ->Arg(16)
+    ->Arg(24);
+BENCHMARK(BM_TravelingSalesman<Tsp::kAntColony>)
+    ->UseRealTime()
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(128);
+BENCHMARK(BM_TravelingSalesman<Tsp::kLinKernighan>)
+    ->UseRealTime()
+    ->Arg(16)
+    ->Arg(128)
+    ->Arg(1024);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,56 @@
+#ifndef _ADJACENCY_LIST_H_
+#define _ADJACENCY_LIST_H_
+
+#include <vector>
+
+#include "t_matrix.h"
+
+namespace s21 {
+
+// Compressed sparse row view of an adjacency matrix: the outgoing edges of
+// vertex v are stored contiguously in [begin(v), end(v)).
+class AdjacencyList {
+ public:
+  struct Edge {
+    int to;
+    int weight;
+  };
+
+  struct Range {
+    const Edge* first;
+    const Edge* last;
+    const Edge* begin() const { return first; }
+    const Edge* end() const { return last; }
+  };
+
+  AdjacencyList() : offsets_(1, 0) {}
+  explicit AdjacencyList(const Matrix<int>& adjacency_matrix)
+      : offsets_(adjacency_matrix.rows() + 1, 0) {
+    size_t order = adjacency_matrix.rows();
+    const int* data = adjacency_matrix.data();
+    for (size_t i = 0; i < order; i++) {
+      for (size_t j = 0; j < order; j++) {
+        if (data[i * order + j] != 0) {
+          edges_.push_back({static_cast<int>(j), data[i * order + j]});
+        }
+      }
+      offsets_[i + 1] = edges_.size();
+    }
+  }
+
+  size_t order() const { return offsets_.size() - 1; }
+  size_t edges_count() const { return edges_.size(); }
+
+  Range neighbors(size_t vertex) const {
+    return {edges_.data() + offsets_[vertex],
+            edges_.data() + offsets_[vertex + 1]};
+  }
+
+ private:
+  std::vector<size_t> offsets_;
+  std::vector<Edge> edges_;
+};
+
+}  // namespace s21
+
+#endif
@@ -1,180 +1,538 @@
 #include "ant_colony_algorithms.h"
 
+#include <cmath>
+#include <limits>
+
+#include "tour_construction.h"
+
 namespace s21 {
+
+namespace {
+
+// Sum of weights[i] * allowed[i]. Four independent accumulators let the
+// compiler keep several multiply-adds in flight and use packed instructions.
+double MaskedSum(const double* weights, const double* allowed, size_t count) {
+  double sum[4] = {0.0, 0.0, 0.0, 0.0};
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    sum[0] += weights[i] * allowed[i];
+    sum[1] += weights[i + 1] * allowed[i + 1];
+    sum[2] += weights[i + 2] * allowed[i + 2];
+    sum[3] += weights[i + 3] * allowed[i + 3];
+  }
+  for (; i < count; i++) {
+    sum[0] += weights[i] * allowed[i];
+  }
+  return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+}
+
+// The allowed vertex with the largest weight among the first `count`, or
+// among `candidates`; -1 when every weight is zero.
+int Heaviest(const double* weights, const double* allowed, size_t count) {
+  int heaviest = -1;
+  double largest = 0.0;
+  for (size_t i = 0; i < count; i++) {
+    if (weights[i] * allowed[i] > largest) {
+      largest = weights[i] * allowed[i];
+      heaviest = static_cast<int>(i);
+    }
+  }
+  return heaviest;
+}
+
+int Heaviest(const double* weights, const double* allowed,
+             CandidateLists::Range candidates) {
+  int heaviest = -1;
+  double largest = 0.0;
+  for (int vertex : candidates) {
+    if (weights[vertex] * allowed[vertex] > largest) {
+      largest = weights[vertex] * allowed[vertex];
+      heaviest = vertex;
+    }
+  }
+  return heaviest;
+}
+
+}  // namespace
 s21::AntColonyAlgorithms::TsmResult
-s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(Graph& graph,
-                                                        size_t iterations,
-                                                        size_t ants_on_vertex) {
+s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+    Graph& graph, size_t iterations, size_t ants_on_vertex,
+    std::optional<uint64_t> seed, size_t num_threads,
+    const Parameters& parameters, const TspSearchControl& control) {
+  if (parameters.islands > 1) {
+    return SolveWithIslands(graph, iterations, ants_on_vertex,
+                            seed ? *seed : RandomSeed(), num_threads,
+                            parameters, control);
+  }
+  TspSearchMonitor monitor(control);
   size_t num_vertices = graph.order();
-  Colony colony(num_vertices * ants_on_vertex, graph.adjacency_matrix());
+  Colony colony(num_vertices * ants_on_vertex, graph.adjacency_matrix(),
+                seed ? *seed : RandomSeed(), num_threads, parameters);
 
   for (size_t i = 0; i < iterations; i++) {
     colony.LaunchIteration();
     colony.UpdatePheromones();
     colony.DistributeAnts();
+    if (monitor.Update(colony.best_ant.path, colony.best_ant.distance)) break;
   }
 
-  return {colony.best_ant.path, colony.best_ant.distance};
+  return {std::move(colony.best_ant.path), colony.best_ant.distance};
+}
+
+s21::AntColonyAlgorithms::TsmResult
+s21::AntColonyAlgorithms::SolveWithIslands(Graph& graph, size_t iterations,
+                                           size_t ants_on_vertex,
+                                           uint64_t seed, size_t num_threads,
+                                           const Parameters& parameters,
+                                           const TspSearchControl& control) {
+  TspSearchMonitor monitor(control);
+  size_t count = parameters.islands;
+  size_t threads = ThreadPool::ResolveThreadCount(num_threads);
+  Xoshiro256 seeds(seed);
+  std::vector<std::unique_ptr<Colony>> islands;
+  for (size_t i = 0; i < count; i++) {
+    islands.push_back(std::make_unique<Colony>(
+        graph.order() * ants_on_vertex, graph.adjacency_matrix(), seeds(),
+        std::max<size_t>(1, threads / count), parameters));
+  }
+
+  // Islands only meet at migrations, which run serially in island order, so
+  // the result does not depend on the number of threads.
+  ThreadPool pool(std::min(count, threads));
+  size_t interval = std::max<size_t>(1, parameters.migration_interval);
+  std::vector<Ant> migrants(count);
+  auto shortest = [&islands] {
+    Ant* best = &islands[0]->best_ant;
+    for (const std::unique_ptr<Colony>& island : islands) {
+      if (island->best_ant.distance < best->distance) {
+        best = &island->best_ant;
+      }
+    }
+    return best;
+  };
+  // The islands may already hold constructive tours.
+  Ant* best = shortest();
+  for (size_t done = 0; done < iterations;) {
+    size_t epoch = std::min(interval, iterations - done);
+    pool.ParallelFor(0, count, [&](size_t i) {
+      for (size_t k = 0; k < epoch; k++) {
+        islands[i]->LaunchIteration();
+        islands[i]->UpdatePheromones();
+        islands[i]->DistributeAnts();
+        if (monitor.Interrupted()) break;
+      }
+    });
+    done += epoch;
+
+    for (size_t i = 0; i < count; i++) {
+      migrants[i].path = islands[i]->best_ant.path;
+      migrants[i].distance = islands[i]->best_ant.distance;
+    }
+    for (size_t i = 0; i < count; i++) {
+      islands[(i + 1) % count]->AcceptMigrant(migrants[i]);
+    }
+    best = shortest();
+    if (monitor.Update(best->path, best->distance)) break;
+  }
+
+  return {std::move(best->path), best->distance};
+}
+
+s21::AntColonyAlgorithms::Colony::Colony(size_t num_ants,
+                                         const Matrix<int>& adjacency_matrix,
+                                         uint64_t seed, size_t num_threads,
+                                         const Parameters& parameters)
+    : parameters_(parameters),
+      adjacency_matrix_(adjacency_matrix),
+      pheromones_(adjacency_matrix.rows(), adjacency_matrix.cols(), 1.0),
+      visibility_(adjacency_matrix.rows(), adjacency_matrix.cols()),
+      choice_(adjacency_matrix.rows(), adjacency_matrix.cols()),
+      candidates_(adjacency_matrix, parameters.candidates),
+      local_search_(adjacency_matrix_, candidates_),
+      anthill_(num_ants),
+      deposits_(std::min(num_ants, kAntGroups)),
+      pool_(std::make_unique<ThreadPool>(num_threads)) {
+  best_ant.path.reserve(adjacency_matrix.rows());
+  best_ant.distance = std::numeric_limits<double>::max();
+  if (parameters_.initial_tour) {
+    TourConstructionAlgorithms::TsmResult tour =
+        TourConstructionAlgorithms::ShortestTour(adjacency_matrix_);
+    if (!tour.vertices.empty()) {
+      best_ant.path = std::move(tour.vertices);
+      best_ant.distance = tour.distance;
+    }
+  }
+  // Non-positive weights get a neutral visibility of 1.
+  for (size_t i = 0; i < visibility_.rows(); i++) {
+    for (size_t j = 0; j < visibility_.cols(); j++) {
+      int weight = adjacency_matrix_(i, j);
+      visibility_(i, j) = weight > 0 ? std::pow(1.0 / weight, parameters_.beta)
+                                     : 1.0;
+    }
+  }
+  Xoshiro256 stream(seed);
+  for (Ant& ant : anthill_) {
+    ant.SetRandomStream(stream);
+    stream.Jump();
+  }
+  DistributeAnts();
+  if (!best_ant.path.empty()) {
+    ScaleLevels();
+  }
 }
 
 void s21::AntColonyAlgorithms::Colony::DistributeAnts() {
   size_t num_vertices = pheromones_.rows();
+  for (size_t i = 0; i < anthill_.size(); i++) {
+    anthill_[i].Reset(i % num_vertices, num_vertices);
+  }
+}
 
-  size_t i = 0;
-  for (; i < num_vertices; i++) {
-    anthill_[i].path.clear();
-    anthill_[i].distance = 0;
-    anthill_[i].path.push_back(i);
+void s21::AntColonyAlgorithms::Colony::LaunchIteration() {
+  size_t num_ants = anthill_.size();
+  size_t num_groups = deposits_.size();
+  size_t num_vertices = adjacency_matrix_.rows();
+
+  double previous_best = best_ant.distance;
+
+  UpdateChoiceMatrix();
+  if (parameters_.strategy == AntColonyStrategy::kColonySystem) {
+    LaunchColonySystem();
+  } else {
+    pool_->ParallelFor(0, num_groups, [&](size_t group) {
+      for (size_t i = num_ants * group / num_groups;
+           i < num_ants * (group + 1) / num_groups; i++) {
+        Ant& ant = anthill_[i];
+        if (ant.path.size() == 1) {
+          ant.Launch(adjacency_matrix_, choice_, &candidates_);
+        }
+      }
+    });
   }
 
-  for (; i < anthill_.size(); i++) {
-    anthill_[i].path.push_back(i % num_vertices);
+  ImproveIterationBest();
+
+  // Only the Ant System lets every ant deposit.
+  pool_->ParallelFor(0, num_groups, [&](size_t group) {
+    std::vector<Deposit>& deposits = deposits_[group];
+    deposits.clear();
+    if (parameters_.strategy != AntColonyStrategy::kAntSystem) return;
+    for (size_t i = num_ants * group / num_groups;
+         i < num_ants * (group + 1) / num_groups; i++) {
+      const Ant& ant = anthill_[i];
+      if (ant.path.size() != num_vertices) {
+        continue;
+      }
+
+      double delta_tau = parameters_.q / ant.distance;
+      for (size_t j = 0; j + 1 < ant.path.size(); j++) {
+        deposits.push_back({ant.path[j], ant.path[j + 1], delta_tau});
+      }
+    }
+  });
+
+  // Ties go to the ant with the lowest index.
+  for (Ant& ant : anthill_) {
+    UpdateBestPath(ant);
   }
+  stale_iterations_ =
+      best_ant.distance < previous_best ? 0 : stale_iterations_ + 1;
 }
 
-void s21::AntColonyAlgorithms::Colony::LaunchIteration() {
+void s21::AntColonyAlgorithms::Colony::LaunchColonySystem() {
+  std::function<void(int, int)> local_update = [this](int from, int to) {
+    double& tau = pheromones_(from, to);
+    tau += parameters_.local_evaporation * (initial_level_ - tau);
+    choice_(from, to) = ChoiceWeight(from, to);
+    if (local_search_.symmetric()) {
+      pheromones_(to, from) = tau;
+      choice_(to, from) = ChoiceWeight(to, from);
+    }
+  };
   for (Ant& ant : anthill_) {
     if (ant.path.size() == 1) {
-      ant.Launch(adjacency_matrix_, pheromones_);
+      ant.Launch(adjacency_matrix_, choice_, &candidates_,
+                 parameters_.exploitation, local_update);
     }
-    UpdateBestPath(ant);
   }
 }
 
-void s21::AntColonyAlgorithms::Colony::UpdatePheromones() {
-  constexpr double ro = 0.66;
+void s21::AntColonyAlgorithms::Colony::ImproveIterationBest() {
+  iteration_best_ = nullptr;
+  for (Ant& ant : anthill_) {
+    if (ant.path.size() == adjacency_matrix_.rows() &&
+        (!iteration_best_ || ant.distance < iteration_best_->distance)) {
+      iteration_best_ = &ant;
+    }
+  }
+  if (iteration_best_ && parameters_.local_search) {
+    iteration_best_->distance =
+        local_search_.Improve(iteration_best_->path, iteration_best_->distance);
+  }
+}
 
-  for (size_t i = 0; i < pheromones_.rows(); i++) {
+double s21::AntColonyAlgorithms::Colony::ChoiceWeight(size_t from,
+                                                      size_t to) const {
+  // Edges keep at least the smallest normal weight so that pheromone
+  // underflow never makes an existing edge unselectable.
+  constexpr double kMinWeight = std::numeric_limits<double>::min();
+  if (!adjacency_matrix_(from, to)) {
+    return 0.0;
+  }
+  double tau = pheromones_(from, to);
+  double alpha = parameters_.alpha;
+  double weight =
+      (alpha == 1.0 ? tau : std::pow(tau, alpha)) * visibility_(from, to);
+  return std::max(weight, kMinWeight);
+}
+
+void s21::AntColonyAlgorithms::Colony::UpdateChoiceMatrix() {
+  pool_->ParallelFor(0, choice_.rows(), [&](size_t i) {
+    for (size_t j = 0; j < choice_.cols(); j++) {
+      choice_(i, j) = ChoiceWeight(i, j);
+    }
+  });
+}
+
+template <typename Update>
+void s21::AntColonyAlgorithms::Colony::ForEachLevel(Update update) {
+  pool_->ParallelFor(0, pheromones_.rows(), [&](size_t i) {
     for (size_t j = 0; j < pheromones_.cols(); j++) {
-      pheromones_(i, j) *= ro;
+      pheromones_(i, j) = update(pheromones_(i, j));
     }
+  });
+}
+
+void s21::AntColonyAlgorithms::Colony::UpdatePheromones() {
+  if (parameters_.strategy == AntColonyStrategy::kMaxMin) {
+    UpdateMaxMinPheromones();
+    return;
+  }
+  if (parameters_.strategy == AntColonyStrategy::kColonySystem) {
+    UpdateColonySystemPheromones();
+    return;
   }
 
-  for (Ant& ant : anthill_) {
-    if (ant.path.size() != adjacency_matrix_.rows()) {
-      continue;
+  double keep = 1.0 - parameters_.evaporation;
+  ForEachLevel([keep](double tau) { return tau * keep; });
+
+  // Buffers are summed in group order so the matrix does not depend on how
+  // the groups were scheduled.
+  for (const std::vector<Deposit>& deposits : deposits_) {
+    for (const Deposit& deposit : deposits) {
+      pheromones_(deposit.from, deposit.to) += deposit.amount;
     }
+  }
+}
+
+void s21::AntColonyAlgorithms::Colony::UpdateMaxMinPheromones() {
+  if (best_ant.path.empty()) {
+    return;
+  }
+  if (!levels_scaled_ || stale_iterations_ >= parameters_.restart_after) {
+    ScaleLevels();
+    stale_iterations_ = 0;
+    return;
+  }
+  double tau_max = DepositFor(best_ant.distance) / parameters_.evaporation;
+  double tau_min = tau_max / (2.0 * adjacency_matrix_.rows());
+
+  double keep = 1.0 - parameters_.evaporation;
+  ForEachLevel([keep, tau_min, tau_max](double tau) {
+    return std::clamp(tau * keep, tau_min, tau_max);
+  });
+  if (iteration_best_) {
+    const std::vector<int>& path = iteration_best_->path;
+    double delta_tau = DepositFor(iteration_best_->distance);
+    ForEachTourEdge(path, [delta_tau, tau_max](double tau) {
+      return std::min(tau + delta_tau, tau_max);
+    });
+  }
+}
 
-    constexpr double q = 4;
-    double delta_tau = q / ant.distance;
+void s21::AntColonyAlgorithms::Colony::UpdateColonySystemPheromones() {
+  if (best_ant.path.empty()) {
+    return;
+  }
+  const std::vector<int>& path = best_ant.path;
+  double delta_tau = DepositFor(best_ant.distance);
+  if (!levels_scaled_) {
+    ScaleLevels();
+    return;
+  }
+
+  double evaporation = parameters_.evaporation;
+  ForEachTourEdge(path, [evaporation, delta_tau](double tau) {
+    return tau + evaporation * (delta_tau - tau);
+  });
+}
 
-    for (size_t i = 0; i < ant.path.size() - 1; i++) {
-      size_t from = ant.path[i];
-      size_t to = ant.path[i + 1];
-      pheromones_(from, to) += delta_tau;
+void s21::AntColonyAlgorithms::Colony::ScaleLevels() {
+  // The usual starting levels for a tour of length L: m / L for the Ant
+  // System with m ants, tau_max for MMAS and 1 / (n * L) for ACS, all scaled
+  // by q.
+  double delta_tau = DepositFor(best_ant.distance);
+  double level = delta_tau * anthill_.size();
+  if (parameters_.strategy == AntColonyStrategy::kMaxMin) {
+    level = delta_tau / parameters_.evaporation;
+  } else if (parameters_.strategy == AntColonyStrategy::kColonySystem) {
+    level = delta_tau / adjacency_matrix_.rows();
+  }
+  initial_level_ = level;
+  ForEachLevel([level](double) { return level; });
+  levels_scaled_ = true;
+}
+
+template <typename Update>
+void s21::AntColonyAlgorithms::Colony::ForEachTourEdge(
+    const std::vector<int>& path, Update update) {
+  for (size_t i = 0; i < path.size(); i++) {
+    int from = path[i];
+    int to = path[(i + 1) % path.size()];
+    pheromones_(from, to) = update(pheromones_(from, to));
+    if (local_search_.symmetric()) {
+      pheromones_(to, from) = pheromones_(from, to);
     }
   }
 }
 
+double s21::AntColonyAlgorithms::Colony::DepositFor(double length) const {
+  return parameters_.q / std::max(length, 1.0);
+}
+
 void s21::AntColonyAlgorithms::Colony::UpdateBestPath(Ant& ant) {
   if (ant.path.size() == adjacency_matrix_.rows() &&
       ant.distance < best_ant.distance) {
-    best_ant = ant;
+    KeepBest(ant);
   }
 }
 
-void s21::AntColonyAlgorithms::Ant::Launch(const Matrix<int>& adj_matrix,
-                                           const Matrix<double>& pheromones) {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<> dis(0.0, 1.0);
-
-  while (path.size() < adj_matrix.rows()) {
-    int current_vertex = path.back();
+void s21::AntColonyAlgorithms::Colony::AcceptMigrant(const Ant& migrant) {
+  if (migrant.path.size() != adjacency_matrix_.rows() ||
+      !(migrant.distance < best_ant.distance)) {
+    return;
+  }
+  KeepBest(migrant);
+  stale_iterations_ = 0;
+  double delta_tau = DepositFor(migrant.distance);
+  ForEachTourEdge(migrant.path,
+                  [delta_tau](double tau) { return tau + delta_tau; });
+}
 
-    std::vector<std::pair<int, double>> probabilities =
-        CalculateProbabilities(current_vertex, adj_matrix, pheromones);
+void s21::AntColonyAlgorithms::Colony::KeepBest(const Ant& ant) {
+  best_ant.path.assign(ant.path.begin(), ant.path.end());
+  best_ant.distance = ant.distance;
+}
 
-    if (probabilities.empty()) {
-      ResetPath(current_vertex);
-      break;
-    }
+void s21::AntColonyAlgorithms::Ant::Reset(int start_vertex,
+                                          size_t num_vertices) {
+  path.reserve(num_vertices);
+  ResetPath(start_vertex);
+}
 
-    NormalizeProbabilities(probabilities);
+void s21::AntColonyAlgorithms::Ant::Launch(const Matrix<int>& adj_matrix,
+                                           const Matrix<double>& choice,
+                                           const CandidateLists* candidates,
+                                           double exploitation,
+                                           const std::function<void(int, int)>&
+                                               on_move) {
+  size_t num_vertices = adj_matrix.rows();
+  // 1.0 for vertices the ant may still visit, 0.0 for the rest.
+  thread_local std::vector<double> allowed;
+  allowed.assign(num_vertices, 1.0);
+  for (int vertex : path) {
+    allowed[vertex] = 0.0;
+  }
 
-    int next_vertex = ChooseNextVertex(probabilities);
+  while (path.size() < num_vertices) {
+    int current_vertex = path.back();
+    const double* weights = choice.data() + current_vertex * num_vertices;
+    int next_vertex = -1;
+    bool exploit = exploitation > 0.0 && rng_.NextDouble() < exploitation;
+    if (candidates) {
+      CandidateLists::Range range = candidates->neighbors(current_vertex);
+      next_vertex = exploit ? Heaviest(weights, allowed.data(), range)
+                            : ChooseCandidate(weights, allowed.data(), range);
+    }
+    if (next_vertex == -1) {
+      next_vertex =
+          exploit ? Heaviest(weights, allowed.data(), num_vertices)
+                  : ChooseNextVertex(weights, allowed.data(), num_vertices);
+    }
     if (next_vertex == -1) {
-      ResetPath(current_vertex);
       break;
     }
 
     path.push_back(next_vertex);
+    allowed[next_vertex] = 0.0;
     distance += adj_matrix(current_vertex, next_vertex);
+    if (on_move) on_move(current_vertex, next_vertex);
   }
 
-  if (path.size() == adj_matrix.rows() &&
-      adj_matrix(path.back(), path.front())) {
+  if (path.size() == num_vertices && adj_matrix(path.back(), path.front())) {
     distance += adj_matrix(path.back(), path.front());
+    if (on_move) on_move(path.back(), path.front());
   } else {
     ResetPath(path.front());
   }
 }
 
-std::vector<std::pair<int, double>>
-s21::AntColonyAlgorithms::Ant::CalculateProbabilities(
-    int current_vertex, const Matrix<int>& adj_matrix,
-    const Matrix<double>& pheromones) {
-  std::vector<std::pair<int, double>> probabilities;
-  double sum_product = 0.0;
-
-  int num_vertices = static_cast<int>(adj_matrix.cols());
-  for (int next_vertex = 0; next_vertex < num_vertices; next_vertex++) {
-    if (!adj_matrix(current_vertex, next_vertex) || IsVisited(next_vertex))
-      continue;
-
-    double pheromone = pheromones(current_vertex, next_vertex);
-    double path_weight = adj_matrix(current_vertex, next_vertex);
-    double product = pheromone * path_weight;
+void s21::AntColonyAlgorithms::Ant::ResetPath(int start_vertex) {
+  path.clear();
+  path.push_back(start_vertex);
+  distance = 0;
+}
 
-    probabilities.emplace_back(next_vertex, product);
-    sum_product += product;
+int s21::AntColonyAlgorithms::Ant::ChooseNextVertex(const double* weights,
+                                                    const double* allowed,
+                                                    size_t count) {
+  double total = MaskedSum(weights, allowed, count);
+  if (!(total > 0.0)) {
+    return -1;
   }
 
-  for (auto& p : probabilities) {
-    p.second /= sum_product;
+  double target = rng_.NextDouble() * total;
+  double cumulative = 0.0;
+  int last = -1;
+  for (size_t i = 0; i < count; i++) {
+    double weight = weights[i] * allowed[i];
+    if (weight > 0.0) {
+      cumulative += weight;
+      last = static_cast<int>(i);
+      if (target < cumulative) {
+        return last;
+      }
+    }
   }
 
-  return probabilities;
+  // Rounding can leave the target just past the last partial sum.
+  return last;
 }
 
-void s21::AntColonyAlgorithms::Ant::NormalizeProbabilities(
-    std::vector<std::pair<int, double>>& probabilities) {
-  double sum_product = 0.0;
-  for (const auto& p : probabilities) {
-    sum_product += p.second;
+int s21::AntColonyAlgorithms::Ant::ChooseCandidate(
+    const double* weights, const double* allowed,
+    CandidateLists::Range candidates) {
+  double total = 0.0;
+  for (int vertex : candidates) {
+    total += weights[vertex] * allowed[vertex];
   }
-
-  for (auto& p : probabilities) {
-    p.second /= sum_product;
+  if (!(total > 0.0)) {
+    return -1;
   }
-}
 
-void s21::AntColonyAlgorithms::Ant::ResetPath(int start_vertex) {
-  path.clear();
-  path.push_back(start_vertex);
-  distance = 0;
-}
-
-bool s21::AntColonyAlgorithms::Ant::IsVisited(int vertex) const {
-  return std::find(path.begin(), path.end(), vertex) != path.end();
-}
-
-int s21::AntColonyAlgorithms::Ant::ChooseNextVertex(
-    const std::vector<std::pair<int, double>>& probabilities) {
-  std::random_device rd;
-  std::mt19937 gen(rd());
-  std::uniform_real_distribution<> dis(0.0, 1.0);
-
-  double random_value = dis(gen);
-  double cumulative_probability = 0.0;
-
-  for (const auto& p : probabilities) {
-    cumulative_probability += p.second;
-    if (random_value <= cumulative_probability) {
-      return p.first;
+  double target = rng_.NextDouble() * total;
+  double cumulative = 0.0;
+  int last = -1;
+  for (int vertex : candidates) {
+    double weight = weights[vertex] * allowed[vertex];
+    if (weight > 0.0) {
+      cumulative += weight;
+      last = vertex;
+      if (target < cumulative) {
+        return last;
+      }
     }
   }
-
-  return -1;
+  return last;
 }
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
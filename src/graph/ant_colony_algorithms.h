@@ -2,67 +2,195 @@
 #define _ANT_COLONY_ALGORITHMS_H_
 
 #include <algorithm>
-#include <random>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
 #include <vector>
 
+#include "candidate_lists.h"
 #include "graph.h"
+#include "random.h"
 #include "t_matrix.h"
+#include "thread_pool.h"
+#include "tsp_local_search.h"
+#include "tsp_search_control.h"
 
 namespace s21 {
 
+// How pheromone is laid down. kAntSystem lets every ant that completes a
+// tour deposit on it. kMaxMin (MAX-MIN Ant System) deposits only on the
+// iteration best tour, keeps the levels within [tau_max / 2n, tau_max] with
+// tau_max = q / (evaporation * best length) and resets them to tau_max when
+// the best tour stops improving. kColonySystem (Ant Colony System) reinforces
+// only the best tour found so far; its ants take the heaviest edge with
+// probability `exploitation` and pull the pheromone of every edge they take
+// back towards the initial level, so they walk one after another. Both keep
+// the pheromone of symmetric graphs symmetric.
+enum class AntColonyStrategy { kAntSystem, kMaxMin, kColonySystem };
+
+// Exponents of the edge choice weight tau^alpha * eta^beta, where tau is the
+// pheromone level and eta = 1 / weight the visibility of the edge. Ants pick
+// among the `candidates` nearest unvisited neighbours and look at every
+// vertex only when all of those are visited; 0 disables the lists. With
+// `local_search` the best tour of every iteration is improved by 2-opt and
+// Or-opt over the same lists before pheromone is deposited. A tour of length
+// L deposits q / L on its edges. With `initial_tour` the colony starts from
+// the shortest constructive tour (TourConstructionAlgorithms::ShortestTour):
+// it is the best tour until the ants find a shorter one, and the pheromone
+// starts at the level its length implies for the strategy instead of 1.
+struct AntColonyParameters {
+  double alpha = 1.0;
+  double beta = 2.0;
+  size_t candidates = 20;
+  bool local_search = true;
+  bool initial_tour = true;
+  AntColonyStrategy strategy = AntColonyStrategy::kAntSystem;
+  // Share of the pheromone that evaporates on every update.
+  double evaporation = 0.34;
+  double q = 4.0;
+  // kMaxMin: iterations without a shorter tour before the levels are reset.
+  size_t restart_after = 50;
+  // kColonySystem: probability of the greedy choice and the share of the
+  // pheromone an ant moves towards the initial level on each edge it takes.
+  double exploitation = 0.9;
+  double local_evaporation = 0.1;
+  // Island model: this many colonies with their own seeds evolve side by
+  // side, and every `migration_interval` iterations each passes its best
+  // tour to the next one in a ring.
+  size_t islands = 1;
+  size_t migration_interval = 10;
+};
+
 class AntColonyAlgorithms {
  public:
-  struct TsmResult {
-    std::vector<int> vertices;
-    double distance;
-  };
+  using TsmResult = s21::TsmResult;
+
+  using Parameters = AntColonyParameters;
 
+  // Buffers are sized once by Reset(), so building a tour allocates nothing.
   class Ant {
    public:
     std::vector<int> path;
     double distance = 0.0;
 
-    void Launch(const Matrix<int>& adj_matrix,
-                const Matrix<double>& pheromones);
-    bool IsVisited(int vertex) const;
-    int ChooseNextVertex(
-        const std::vector<std::pair<int, double>>& probabilities);
+    void Reset(int start_vertex, size_t num_vertices);
+    void SetRandomStream(const Xoshiro256& rng) { rng_ = rng; }
+    // `choice` holds the weight of every edge and must be zero where
+    // adj_matrix has no edge. Without `candidates` every step scans the row.
+    // With probability `exploitation` a step takes the heaviest edge instead
+    // of drawing one. `on_move` is called for every edge the ant takes.
+    void Launch(const Matrix<int>& adj_matrix, const Matrix<double>& choice,
+                const CandidateLists* candidates = nullptr,
+                double exploitation = 0.0,
+                const std::function<void(int, int)>& on_move = nullptr);
 
    private:
-    std::vector<std::pair<int, double>> CalculateProbabilities(
-        int current_vertex, const Matrix<int>& adj_matrix,
-        const Matrix<double>& pheromones);
-    void NormalizeProbabilities(
-        std::vector<std::pair<int, double>>& probabilities);
+    // Roulette wheel over weights[i] * allowed[i] with a single draw; -1 when
+    // every weight is zero.
+    int ChooseNextVertex(const double* weights, const double* allowed,
+                         size_t count);
+    // The same over the listed vertices only.
+    int ChooseCandidate(const double* weights, const double* allowed,
+                        CandidateLists::Range candidates);
     void ResetPath(int start_vertex);
+
+    Xoshiro256 rng_;
   };
 
   class Colony {
    public:
-    Colony(size_t num_ants, const Matrix<int>& adjacency_matrix)
-        : best_ant(Ant{std::vector<int>(), std::numeric_limits<double>::max()}),
-          adjacency_matrix_(adjacency_matrix) {
-      pheromones_ =
-          Matrix<double>(adjacency_matrix.rows(), adjacency_matrix.cols(), 1.0);
-      anthill_.resize(num_ants);
-    }
+    // Every ant draws from its own stream, jumped ahead from `seed`. Tours are
+    // built on `num_threads` workers (0 - all hardware threads); the result
+    // for a given seed does not depend on the number of threads. The colony
+    // keeps a reference to `adjacency_matrix`, which must outlive it.
+    Colony(size_t num_ants, const Matrix<int>& adjacency_matrix,
+           uint64_t seed = RandomSeed(), size_t num_threads = 0,
+           const Parameters& parameters = Parameters());
 
     void DistributeAnts();
     void LaunchIteration();
     void UpdatePheromones();
     void UpdateBestPath(Ant& ant);
+    // Takes a tour found elsewhere: if it is shorter than best_ant it
+    // replaces it and gets a deposit of q / length.
+    void AcceptMigrant(const Ant& migrant);
 
     Ant best_ant;
 
    private:
-    Matrix<int> adjacency_matrix_;
+    struct Deposit {
+      int from;
+      int to;
+      double amount;
+    };
+
+    // Ants are split into this many contiguous groups, each with its own
+    // deposit buffer, so the reduction order is fixed.
+    static constexpr size_t kAntGroups = 64;
+
+    // Sets every level to the starting level the strategy derives from the
+    // length of best_ant.
+    void ScaleLevels();
+    double ChoiceWeight(size_t from, size_t to) const;
+    // Fills choice_ from the current pheromone levels.
+    void UpdateChoiceMatrix();
+    // Builds the tours of the Ant Colony System with local pheromone updates.
+    void LaunchColonySystem();
+    // Points iteration_best_ at the shortest tour built this iteration and
+    // runs the local search on it.
+    void ImproveIterationBest();
+    void UpdateMaxMinPheromones();
+    void UpdateColonySystemPheromones();
+    // Applies `update` to the pheromone level of every edge, row by row.
+    template <typename Update>
+    void ForEachLevel(Update update);
+    // Applies `update` to the edges of the closed tour `path`, and to their
+    // reversals on symmetric graphs.
+    template <typename Update>
+    void ForEachTourEdge(const std::vector<int>& path, Update update);
+    // q / length, with tours of non-positive length counted as length 1.
+    double DepositFor(double length) const;
+
+    // Replaces best_ant's tour by that of `ant`, reusing its buffer.
+    void KeepBest(const Ant& ant);
+
+    Parameters parameters_;
+    const Matrix<int>& adjacency_matrix_;
     Matrix<double> pheromones_;
+    // eta^beta, fixed for the whole run.
+    Matrix<double> visibility_;
+    Matrix<double> choice_;
+    CandidateLists candidates_;
+    TspLocalSearch local_search_;
     std::vector<Ant> anthill_;
+    std::vector<std::vector<Deposit>> deposits_;
+    std::unique_ptr<ThreadPool> pool_;
+    Ant* iteration_best_ = nullptr;
+    size_t stale_iterations_ = 0;
+    // kMaxMin and kColonySystem scale the levels once the first tour is
+    // known.
+    bool levels_scaled_ = false;
+    double initial_level_ = 1.0;
   };
 
-  static TsmResult SolveTravelingSalesmanProblem(Graph& graph,
-                                                 size_t iterations = 10,
-                                                 size_t ants_on_vertex = 1);
+  // Runs are reproducible when `seed` is given, for any `num_threads`.
+  // `control` can end the run before `iterations`; at least one iteration
+  // always runs, so a tour is returned whenever the ants find one. Islands
+  // run on separate threads, sharing `num_threads` between them, and
+  // `control` sees the best tour of all islands at every migration.
+  static TsmResult SolveTravelingSalesmanProblem(
+      Graph& graph, size_t iterations = 10, size_t ants_on_vertex = 1,
+      std::optional<uint64_t> seed = std::nullopt, size_t num_threads = 0,
+      const Parameters& parameters = Parameters(),
+      const TspSearchControl& control = TspSearchControl());
+
+ private:
+  static TsmResult SolveWithIslands(Graph& graph, size_t iterations,
+                                    size_t ants_on_vertex, uint64_t seed,
+                                    size_t num_threads,
+                                    const Parameters& parameters,
+                                    const TspSearchControl& control);
 };
 }  // namespace s21
 #endif
\ No newline at end of file
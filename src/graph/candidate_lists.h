@@ -0,0 +1,60 @@
+#ifndef _CANDIDATE_LISTS_H_
+#define _CANDIDATE_LISTS_H_
+
+#include <algorithm>
+#include <vector>
+
+#include "t_matrix.h"
+
+namespace s21 {
+
+// The k cheapest outgoing edges of every vertex, nearest first and ties
+// broken by vertex index. Vertices with fewer than k edges keep all of them.
+class CandidateLists {
+ public:
+  struct Range {
+    const int* first;
+    const int* last;
+    const int* begin() const { return first; }
+    const int* end() const { return last; }
+    size_t size() const { return last - first; }
+  };
+
+  CandidateLists(const Matrix<int>& adjacency_matrix, size_t k)
+      : offsets_(adjacency_matrix.rows() + 1, 0) {
+    size_t order = adjacency_matrix.rows();
+    const int* data = adjacency_matrix.data();
+    std::vector<int> row;
+    for (size_t i = 0; i < order; i++) {
+      const int* weights = data + i * order;
+      row.clear();
+      for (size_t j = 0; j < order; j++) {
+        if (j != i && weights[j] != 0) {
+          row.push_back(static_cast<int>(j));
+        }
+      }
+      auto nearer = [weights](int a, int b) {
+        return weights[a] != weights[b] ? weights[a] < weights[b] : a < b;
+      };
+      size_t count = std::min(k, row.size());
+      std::partial_sort(row.begin(), row.begin() + count, row.end(), nearer);
+      vertices_.insert(vertices_.end(), row.begin(), row.begin() + count);
+      offsets_[i + 1] = vertices_.size();
+    }
+  }
+
+  size_t order() const { return offsets_.size() - 1; }
+
+  Range neighbors(size_t vertex) const {
+    return {vertices_.data() + offsets_[vertex],
+            vertices_.data() + offsets_[vertex + 1]};
+  }
+
+ private:
+  std::vector<size_t> offsets_;
+  std::vector<int> vertices_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,260 @@
+#include "distance_table.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace s21 {
+
+namespace {
+
+constexpr char kMagic[8] = "S21DIST";
+constexpr uint32_t kVersion = 1;
+constexpr uint16_t kSaturated = std::numeric_limits<uint16_t>::max();
+constexpr int kInfinity = std::numeric_limits<int>::max();
+
+struct FileHeader {
+  char magic[8];
+  uint32_t version;
+  uint32_t encoding;
+  uint64_t order;
+  uint64_t reserved;
+};
+
+size_t CellWidth(DistanceEncoding encoding) {
+  return encoding == DistanceEncoding::kUInt16Saturated ? sizeof(uint16_t)
+                                                        : sizeof(int32_t);
+}
+
+// Delta-encoded files keep an (offset, size) pair per row after the header.
+size_t DeltaDataOffset(size_t order) {
+  return sizeof(FileHeader) + 2 * sizeof(uint64_t) * order;
+}
+
+void WriteAll(int fd, const void* data, size_t size, uint64_t offset) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  while (size > 0) {
+    ssize_t written = pwrite(fd, bytes, size, offset);
+    if (written <= 0) {
+      throw std::runtime_error("Unable to write distance table");
+    }
+    bytes += written;
+    size -= written;
+    offset += written;
+  }
+}
+
+void EncodeDelta(const int* row, size_t order, std::vector<uint8_t>& out) {
+  out.clear();
+  int64_t previous = 0;
+  for (size_t i = 0; i < order; i++) {
+    int64_t delta = static_cast<int64_t>(row[i]) - previous;
+    previous = row[i];
+    uint64_t value = (static_cast<uint64_t>(delta) << 1) ^
+                     static_cast<uint64_t>(delta >> 63);
+    while (value >= 0x80) {
+      out.push_back(static_cast<uint8_t>(value | 0x80));
+      value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+  }
+}
+
+}  // namespace
+
+DistanceTableWriter::DistanceTableWriter(const std::string& filename,
+                                         size_t order,
+                                         DistanceEncoding encoding)
+    : order_(order), encoding_(encoding) {
+  fd_ = open(filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd_ < 0) {
+    throw std::runtime_error("Unable to open distance table file");
+  }
+
+  FileHeader header{};
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.encoding = static_cast<uint32_t>(encoding);
+  header.order = order;
+
+  if (encoding == DistanceEncoding::kDelta) {
+    row_offsets_.assign(2 * order, 0);
+    end_offset_ = DeltaDataOffset(order);
+    try {
+      WriteAll(fd_, &header, sizeof(header), 0);
+    } catch (...) {
+      close(fd_);
+      throw;
+    }
+    return;
+  }
+
+  mapping_size_ = sizeof(FileHeader) + order * order * CellWidth(encoding);
+  if (ftruncate(fd_, mapping_size_) != 0) {
+    close(fd_);
+    throw std::runtime_error("Unable to resize distance table file");
+  }
+  void* mapping =
+      mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  if (mapping == MAP_FAILED) {
+    close(fd_);
+    throw std::runtime_error("Unable to map distance table file");
+  }
+  mapping_ = static_cast<uint8_t*>(mapping);
+  std::memcpy(mapping_, &header, sizeof(header));
+}
+
+DistanceTableWriter::~DistanceTableWriter() {
+  try {
+    Close();
+  } catch (...) {
+  }
+}
+
+void DistanceTableWriter::WriteRow(int source, const int* row) {
+  if (source < 0 || static_cast<size_t>(source) >= order_) {
+    throw std::out_of_range("No such vertex.");
+  }
+
+  if (encoding_ == DistanceEncoding::kDelta) {
+    thread_local std::vector<uint8_t> buffer;
+    EncodeDelta(row, order_, buffer);
+    uint64_t offset = end_offset_.fetch_add(buffer.size());
+    WriteAll(fd_, buffer.data(), buffer.size(), offset);
+    row_offsets_[2 * source] = offset;
+    row_offsets_[2 * source + 1] = buffer.size();
+    return;
+  }
+
+  uint8_t* cells = mapping_ + sizeof(FileHeader) +
+                   static_cast<size_t>(source) * order_ * CellWidth(encoding_);
+  if (encoding_ == DistanceEncoding::kInt32) {
+    std::memcpy(cells, row, order_ * sizeof(int32_t));
+    return;
+  }
+
+  uint16_t* narrow = reinterpret_cast<uint16_t*>(cells);
+  for (size_t i = 0; i < order_; i++) {
+    narrow[i] = row[i] < 0            ? 0
+                : row[i] > kSaturated ? kSaturated
+                                      : static_cast<uint16_t>(row[i]);
+  }
+}
+
+void DistanceTableWriter::Close() {
+  if (fd_ < 0) {
+    return;
+  }
+  if (mapping_ != nullptr) {
+    munmap(mapping_, mapping_size_);
+    mapping_ = nullptr;
+  } else {
+    WriteAll(fd_, row_offsets_.data(), row_offsets_.size() * sizeof(uint64_t),
+             sizeof(FileHeader));
+  }
+  close(fd_);
+  fd_ = -1;
+}
+
+DistanceTableReader::DistanceTableReader(const std::string& filename) {
+  fd_ = open(filename.c_str(), O_RDONLY);
+  if (fd_ < 0) {
+    throw std::runtime_error("Unable to open distance table file");
+  }
+  struct stat info;
+  if (fstat(fd_, &info) != 0 ||
+      static_cast<size_t>(info.st_size) < sizeof(FileHeader)) {
+    close(fd_);
+    throw std::runtime_error("Invalid distance table file");
+  }
+  mapping_size_ = info.st_size;
+  void* mapping = mmap(nullptr, mapping_size_, PROT_READ, MAP_SHARED, fd_, 0);
+  if (mapping == MAP_FAILED) {
+    close(fd_);
+    throw std::runtime_error("Unable to map distance table file");
+  }
+  mapping_ = static_cast<const uint8_t*>(mapping);
+
+  FileHeader header;
+  std::memcpy(&header, mapping_, sizeof(header));
+  if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+      header.version != kVersion ||
+      header.encoding > static_cast<uint32_t>(DistanceEncoding::kDelta)) {
+    munmap(const_cast<uint8_t*>(mapping_), mapping_size_);
+    close(fd_);
+    throw std::runtime_error("Invalid distance table file");
+  }
+  order_ = header.order;
+  encoding_ = static_cast<DistanceEncoding>(header.encoding);
+
+  size_t expected_size =
+      encoding_ == DistanceEncoding::kDelta
+          ? DeltaDataOffset(order_)
+          : sizeof(FileHeader) + order_ * order_ * CellWidth(encoding_);
+  if (mapping_size_ < expected_size) {
+    munmap(const_cast<uint8_t*>(mapping_), mapping_size_);
+    close(fd_);
+    throw std::runtime_error("Invalid distance table file");
+  }
+}
+
+DistanceTableReader::~DistanceTableReader() {
+  munmap(const_cast<uint8_t*>(mapping_), mapping_size_);
+  close(fd_);
+}
+
+std::vector<int> DistanceTableReader::ReadRow(int source) const {
+  if (source < 0 || static_cast<size_t>(source) >= order_) {
+    throw std::out_of_range("No such vertex.");
+  }
+  std::vector<int> row(order_);
+
+  if (encoding_ == DistanceEncoding::kDelta) {
+    uint64_t entry[2];
+    std::memcpy(entry,
+                mapping_ + sizeof(FileHeader) + 2 * sizeof(uint64_t) * source,
+                sizeof(entry));
+    if (entry[0] + entry[1] > mapping_size_) {
+      throw std::runtime_error("Invalid distance table file");
+    }
+    const uint8_t* bytes = mapping_ + entry[0];
+    const uint8_t* end = bytes + entry[1];
+    int64_t value = 0;
+    for (size_t i = 0; i < order_; i++) {
+      // A 64-bit value takes at most ten bytes, the last at shift 63.
+      uint64_t zigzag = 0;
+      for (int shift = 0;; shift += 7) {
+        if (bytes == end || shift > 63) {
+          throw std::runtime_error("Invalid distance table file");
+        }
+        uint8_t byte = *bytes++;
+        zigzag |= static_cast<uint64_t>(byte & 0x7f) << shift;
+        if (!(byte & 0x80)) break;
+      }
+      value += static_cast<int64_t>(zigzag >> 1) ^
+               -static_cast<int64_t>(zigzag & 1);
+      row[i] = static_cast<int>(value);
+    }
+    return row;
+  }
+
+  const uint8_t* cells =
+      mapping_ + sizeof(FileHeader) +
+      static_cast<size_t>(source) * order_ * CellWidth(encoding_);
+  if (encoding_ == DistanceEncoding::kInt32) {
+    std::memcpy(row.data(), cells, order_ * sizeof(int32_t));
+  } else {
+    const uint16_t* narrow = reinterpret_cast<const uint16_t*>(cells);
+    for (size_t i = 0; i < order_; i++) {
+      row[i] = narrow[i] == kSaturated ? kInfinity : narrow[i];
+    }
+  }
+  return row;
+}
+
+}  // namespace s21
@@ -0,0 +1,65 @@
+#ifndef _DISTANCE_TABLE_H_
+#define _DISTANCE_TABLE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace s21 {
+
+// kInt32 stores distances as is. kUInt16Saturated clamps them to
+// [0, 65535]; 65535 and above read back as infinity. kDelta stores each row
+// as zigzag varints of the differences between neighbouring cells.
+enum class DistanceEncoding : uint32_t { kInt32, kUInt16Saturated, kDelta };
+
+// Writes an order x order distance table row by row into a file. Fixed-width
+// encodings are written straight into a memory-mapped file; delta-encoded rows
+// are appended as they arrive and indexed on Close(). WriteRow may be called
+// concurrently for different rows.
+class DistanceTableWriter {
+ public:
+  DistanceTableWriter(const std::string& filename, size_t order,
+                      DistanceEncoding encoding);
+  ~DistanceTableWriter();
+
+  DistanceTableWriter(const DistanceTableWriter& other) = delete;
+  DistanceTableWriter& operator=(const DistanceTableWriter& other) = delete;
+
+  void WriteRow(int source, const int* row);
+  void Close();
+
+ private:
+  int fd_ = -1;
+  size_t order_;
+  DistanceEncoding encoding_;
+  uint8_t* mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+  std::vector<uint64_t> row_offsets_;
+  std::atomic<uint64_t> end_offset_{0};
+};
+
+class DistanceTableReader {
+ public:
+  explicit DistanceTableReader(const std::string& filename);
+  ~DistanceTableReader();
+
+  DistanceTableReader(const DistanceTableReader& other) = delete;
+  DistanceTableReader& operator=(const DistanceTableReader& other) = delete;
+
+  std::vector<int> ReadRow(int source) const;
+
+  size_t order() const { return order_; }
+  DistanceEncoding encoding() const { return encoding_; }
+
+ private:
+  int fd_ = -1;
+  size_t order_ = 0;
+  DistanceEncoding encoding_ = DistanceEncoding::kInt32;
+  const uint8_t* mapping_ = nullptr;
+  size_t mapping_size_ = 0;
+};
+
+}  // namespace s21
+
+#endif
@@ -1,7 +1,15 @@
 #include "graph.h"
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
 namespace s21 {
 
+namespace {
+std::atomic<uint64_t> next_version{1};
+}
+
 void Graph::LoadGraphFromFile(const std::string& filepath) {
   std::ifstream f(filepath);
   if (!f) {
@@ -27,9 +35,27 @@ void Graph::LoadGraphFromFile(const std::string& filepath) {
   }
 
   adjacency_matrix_ = std::move(adjacency_matrix);
+  AnalyzeEdges();
   f.close();
 }
 
+void Graph::AnalyzeEdges() {
+  version_ = next_version++;
+  adjacency_list_ = AdjacencyList(adjacency_matrix_);
+  edges_count_ = adjacency_list_.edges_count();
+  min_weight_ = std::numeric_limits<int>::max();
+  max_weight_ = std::numeric_limits<int>::min();
+  for (size_t i = 0; i < order(); i++) {
+    for (const AdjacencyList::Edge& edge : adjacency_list_.neighbors(i)) {
+      min_weight_ = std::min(min_weight_, edge.weight);
+      max_weight_ = std::max(max_weight_, edge.weight);
+    }
+  }
+  if (edges_count_ == 0) {
+    min_weight_ = max_weight_ = 0;
+  }
+}
+
 bool Graph::IsDirected() const {
   for (size_t i = 0; i < order(); i++) {
     for (size_t j = i + 1; j < order(); j++) {
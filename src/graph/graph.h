@@ -1,17 +1,22 @@
 #ifndef _GRAPH_H_
 #define _GRAPH_H_
 
+#include <cstdint>
 #include <fstream>
 #include <iostream>
 #include <memory>
 
+#include "adjacency_list.h"
 #include "t_matrix.h"
 
 namespace s21 {
 
 class Graph {
  public:
-  Graph(Matrix<int>&& adjencyMatrix) : adjacency_matrix_(adjencyMatrix){};
+  Graph(Matrix<int>&& adjencyMatrix)
+      : adjacency_matrix_(std::move(adjencyMatrix)) {
+    AnalyzeEdges();
+  };
   Graph() = default;
 
   Graph& operator=(const Graph& other) = default;
@@ -23,12 +28,34 @@ class Graph {
   bool IsDirected() const;
 
   size_t order() const { return adjacency_matrix_.rows(); };
+  size_t edges_count() const { return edges_count_; };
+
+  // Changes whenever a new adjacency matrix is loaded; two graphs with the
+  // same version have the same edges.
+  uint64_t version() const { return version_; };
+  int min_weight() const { return min_weight_; };
+  int max_weight() const { return max_weight_; };
+
+  // True when every edge weight is a positive integer not above `limit`.
+  bool HasBoundedWeights(int limit) const {
+    return min_weight_ > 0 && max_weight_ <= limit;
+  };
 
   const Matrix<int>& adjacency_matrix() const { return adjacency_matrix_; };
+  // Built together with the matrix, so searches over the edges do not pay
+  // for a conversion each time.
+  const AdjacencyList& adjacency_list() const { return adjacency_list_; };
 
  private:
+  void AnalyzeEdges();
+
   Matrix<int> adjacency_matrix_;
+  AdjacencyList adjacency_list_;
   size_t numVertices;
+  size_t edges_count_ = 0;
+  int min_weight_ = 0;
+  int max_weight_ = 0;
+  uint64_t version_ = 0;
 };
 
 }  // namespace s21
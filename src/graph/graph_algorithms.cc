@@ -1,5 +1,8 @@
 #include "graph_algorithms.h"
 
+#include <algorithm>
+#include <cmath>
+
 namespace s21 {
 
 std::vector<int> GraphAlgorithms::FordBellmanAlgorithm(const Graph& graph,
@@ -136,11 +139,133 @@ int GraphAlgorithms::DijkstraMinWeightAlgorithm(Graph& graph, int start_vertex,
 
 int GraphAlgorithms::GetShortestPathBetweenVertices(Graph& graph, int vertex1,
                                                     int vertex2) {
-  return DijkstraMinWeightAlgorithm(graph, vertex1, vertex2);
+  if (graph.min_weight() < 0) {
+    return DijkstraMinWeightAlgorithm(graph, vertex1, vertex2);
+  }
+  if (vertex1 < 0 || vertex2 < 0 ||
+      static_cast<size_t>(vertex1) >= graph.order() ||
+      static_cast<size_t>(vertex2) >= graph.order()) {
+    throw std::runtime_error("Invalid input");
+  }
+
+  int cost = CachedShortestPathTree(graph, vertex1)->distance[vertex2];
+  if (cost == ShortestPathAlgorithms::kInfinity) {
+    throw std::runtime_error("No Path");
+  }
+  return cost;
+}
+
+std::vector<int> GraphAlgorithms::GetShortestPathsFromVertex(Graph& graph,
+                                                             int start_vertex) {
+  if (start_vertex < 0 || static_cast<size_t>(start_vertex) >= graph.order()) {
+    throw std::runtime_error("No such vertex.");
+  }
+  if (graph.min_weight() < 0) {
+    return FordBellmanAlgorithm(graph, start_vertex);
+  }
+  return CachedShortestPathTree(graph, start_vertex)->distance;
+}
+
+ShortestPathTree GraphAlgorithms::GetShortestPathTree(Graph& graph,
+                                                     int start_vertex) {
+  if (start_vertex < 0 || static_cast<size_t>(start_vertex) >= graph.order()) {
+    throw std::runtime_error("No such vertex.");
+  }
+  if (graph.min_weight() < 0) {
+    return ShortestPathAlgorithms::BellmanFordTree(graph.adjacency_list(),
+                                                   start_vertex);
+  }
+  return *CachedShortestPathTree(graph, start_vertex);
+}
+
+ShortestPathCache& GraphAlgorithms::path_cache() {
+  static ShortestPathCache cache;
+  return cache;
+}
+
+ShortestPathCache::TreePtr GraphAlgorithms::CachedShortestPathTree(
+    const Graph& graph, int start_vertex) {
+  using Algorithm = ShortestPathCache::Algorithm;
+  Algorithm algorithm =
+      graph.HasBoundedWeights(ShortestPathAlgorithms::kDialMaxWeight)
+          ? Algorithm::kDial
+          : Algorithm::kRadixHeap;
+
+  return path_cache().GetOrCompute(
+      {graph.version(), algorithm, start_vertex}, [&] {
+        const AdjacencyList& list = graph.adjacency_list();
+        ShortestPathTree tree;
+        tree.source = start_vertex;
+        tree.distance =
+            algorithm == Algorithm::kDial
+                ? ShortestPathAlgorithms::Dial(list, start_vertex,
+                                               graph.max_weight(), &tree.parent)
+                : ShortestPathAlgorithms::RadixHeapDijkstra(list, start_vertex,
+                                                            &tree.parent);
+        return tree;
+      });
+}
+
+Matrix<int> GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+    Graph& graph, size_t threads, ApspEngine engine) {
+  if (engine == ApspEngine::kAuto) {
+    engine = graph.order() > ShortestPathAlgorithms::kFloydTileSize &&
+                     IsSparse(graph)
+                 ? ApspEngine::kJohnson
+                 : ApspEngine::kFloyd;
+  }
+  if (engine == ApspEngine::kJohnson) {
+    return ShortestPathAlgorithms::Johnson(graph.adjacency_matrix(), threads);
+  }
+  if (graph.order() <= ShortestPathAlgorithms::kFloydTileSize) {
+    return FloydsAlgorithm(graph);
+  }
+  return ShortestPathAlgorithms::ParallelFloydWarshall(graph.adjacency_matrix(),
+                                                       threads);
+}
+
+void GraphAlgorithms::StreamShortestPathsBetweenAllVertices(
+    Graph& graph, const ShortestPathAlgorithms::RowCallback& on_row,
+    size_t threads) {
+  ShortestPathAlgorithms::StreamAllPairs(graph.adjacency_matrix(), on_row,
+                                         threads);
+}
+
+void GraphAlgorithms::ExportShortestPathsBetweenAllVertices(
+    Graph& graph, const std::string& filename, DistanceEncoding encoding,
+    size_t threads) {
+  DistanceTableWriter writer(filename, graph.order(), encoding);
+  ShortestPathAlgorithms::StreamAllPairs(
+      graph.adjacency_matrix(),
+      [&writer](int source, const int* row) { writer.WriteRow(source, row); },
+      threads);
+  writer.Close();
 }
 
-Matrix<int> GraphAlgorithms::GetShortestPathsBetweenAllVertices(Graph& graph) {
-  return FloydsAlgorithm(graph);
+Matrix<int> GraphAlgorithms::GetDistanceTable(Graph& graph,
+                                              const std::vector<int>& origins,
+                                              const std::vector<int>& targets,
+                                              size_t threads) {
+  if (origins.empty() || targets.empty()) {
+    throw std::runtime_error("Invalid input");
+  }
+  for (const std::vector<int>* vertices : {&origins, &targets}) {
+    for (int vertex : *vertices) {
+      if (vertex < 0 || static_cast<size_t>(vertex) >= graph.order()) {
+        throw std::runtime_error("No such vertex.");
+      }
+    }
+  }
+  return ShortestPathAlgorithms::DistanceTable(graph.adjacency_matrix(),
+                                               origins, targets, threads);
+}
+
+bool GraphAlgorithms::IsSparse(const Graph& graph) {
+  // A heap pass over the edges costs about E * log(V) against V^2 for a scan
+  // of the matrix, whose inner loop is several times cheaper than a heap
+  // operation.
+  double order = graph.order();
+  return 8.0 * graph.edges_count() * std::log2(order) < order * order;
 }
 
 Matrix<int> GraphAlgorithms::FloydsAlgorithm(Graph& graph) {
@@ -176,49 +301,103 @@ Matrix<int> GraphAlgorithms::FloydsAlgorithm(Graph& graph) {
 }
 
 Matrix<int> GraphAlgorithms::GetLeastSpanningTree(Graph& graph) {
-  const int inf = std::numeric_limits<int>::max();
+  return GetLeastSpanningTreeEdges(graph).ToMatrix();
+}
+
+SpanningTree GraphAlgorithms::GetLeastSpanningTreeEdges(Graph& graph) {
   const Matrix<int>& adjacency_matrix = graph.adjacency_matrix();
-  size_t order = graph.order();
-  Matrix<int> mst_matrix(order, order);
-  std::vector<bool> selected(order, false);
-  selected[0] = true;
-
-  for (size_t edge_number = 0; edge_number < order - 1; edge_number++) {
-    int min = inf;
-    int x = 0;
-    int y = 0;
-
-    for (size_t i = 0; i < order; i++) {
-      if (selected[i]) {
-        for (size_t j = 0; j < order; j++) {
-          if (!selected[j] && adjacency_matrix(i, j)) {
-            if (min > adjacency_matrix(i, j)) {
-              min = adjacency_matrix(i, j);
-              x = i;
-              y = j;
-            }
-          }
-        }
-      }
-    }
-    mst_matrix(x, y) = adjacency_matrix(x, y);
-    mst_matrix(y, x) = adjacency_matrix(x, y);
-    selected[y] = true;
-  }
+  std::vector<int> parent =
+      IsSparse(graph)
+          ? SpanningTreeAlgorithms::PrimHeap(graph.adjacency_list())
+          : SpanningTreeAlgorithms::PrimDense(adjacency_matrix);
+  return SpanningTreeAlgorithms::ParentsToTree(adjacency_matrix, parent);
+}
 
-  return mst_matrix;
+SpanningTree GraphAlgorithms::GetMinimumSpanningForest(Graph& graph,
+                                                       size_t threads,
+                                                       MstEngine engine) {
+  if (engine == MstEngine::kAuto) {
+    engine = ThreadPool::ResolveThreadCount(threads) > 1
+                 ? MstEngine::kBoruvka
+                 : MstEngine::kFilterKruskal;
+  }
+  if (engine == MstEngine::kBoruvka) {
+    return {graph.order(), SpanningTreeAlgorithms::Boruvka(
+                               graph.adjacency_matrix(), threads)};
+  }
+  return {graph.order(),
+          SpanningTreeAlgorithms::FilterKruskal(
+              SpanningTreeAlgorithms::UndirectedEdges(graph.adjacency_matrix()),
+              graph.order(), threads)};
 }
 
 GraphAlgorithms::TsmResult GraphAlgorithms::SolveTravelingSalesmanProblem(
-    Graph& graph) {
-  s21::AntColonyAlgorithms::TsmResult result =
-      AntColonyAlgorithms::SolveTravelingSalesmanProblem(graph, 75, 2);
-  if (result.distance == 0) {
+    Graph& graph, std::optional<uint64_t> seed, size_t threads,
+    TspEngine engine, const TspSearchControl& control) {
+  if (engine == TspEngine::kAuto) {
+    engine = graph.order() <= kExactTspOrder       ? TspEngine::kHeldKarp
+             : graph.order() <= kAntColonyTspOrder ? TspEngine::kAntColony
+                                                   : TspEngine::kLinKernighan;
+  }
+  if (engine == TspEngine::kBranchAndBound) {
+    return SolveTravelingSalesmanProblemWithBound(graph, seed, threads,
+                                                  control);
+  }
+  // A budget replaces the fixed amount of work of the heuristics.
+  bool anytime = control.time_budget.count() > 0;
+  TsmResult result;
+  if (engine == TspEngine::kHeldKarp) {
+    result = TspExactAlgorithms::HeldKarp(graph.adjacency_matrix(), threads);
+    if (!result.vertices.empty() && control.on_improvement) {
+      control.on_improvement(result.vertices, result.distance);
+    }
+  } else if (engine == TspEngine::kLinKernighan) {
+    LinKernighanParameters parameters;
+    if (anytime) parameters.kicks = std::numeric_limits<size_t>::max();
+    result = LinKernighanAlgorithms::SolveTravelingSalesmanProblem(
+        graph.adjacency_matrix(), parameters, seed, control);
+  } else {
+    size_t iterations = anytime ? std::numeric_limits<size_t>::max() : 75;
+    result = AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+        graph, iterations, 2, seed, threads, AntColonyParameters(), control);
+  }
+  if (result.vertices.empty() || result.distance == 0) {
     throw std::runtime_error("No path. ");
   }
 
-  return GraphAlgorithms::TsmResult{std::move(result.vertices),
-                                    std::move(result.distance)};
+  return result;
+}
+
+TspExactAlgorithms::BoundedResult
+GraphAlgorithms::SolveTravelingSalesmanProblemWithBound(
+    Graph& graph, std::optional<uint64_t> seed, size_t threads,
+    const TspSearchControl& control) {
+  auto start = std::chrono::steady_clock::now();
+  // Checked before the colony warm start, which would otherwise run first.
+  if (graph.order() > TspExactAlgorithms::kBranchAndBoundMaxOrder) {
+    throw std::runtime_error("Graph is too large for branch and bound");
+  }
+  TsmResult colony = AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+      graph, 75, 2, seed, threads, AntColonyParameters(), control);
+  std::chrono::milliseconds limit = kBranchAndBoundTimeLimit;
+  if (control.time_budget.count() > 0) {
+    // Zero would mean no limit, so a spent budget still gets 1 ms.
+    auto spent = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    limit = std::max(control.time_budget - spent,
+                     std::chrono::milliseconds(1));
+  }
+  TspExactAlgorithms::BoundedResult result =
+      TspExactAlgorithms::BranchAndBound(graph.adjacency_matrix(),
+                                         colony.vertices, limit, threads,
+                                         control.cancel);
+  if (result.distance < colony.distance && control.on_improvement) {
+    control.on_improvement(result.vertices, result.distance);
+  }
+  if (result.vertices.empty() || result.distance == 0) {
+    throw std::runtime_error("No path. ");
+  }
+  return result;
 }
 
-}
\ No newline at end of file
+}
@@ -1,23 +1,45 @@
 #ifndef _GRAPH_ALGORITHMS_H_
 #define _GRAPH_ALGORITHMS_H_
 
+#include <chrono>
 #include <limits>
 #include <vector>
 
 #include "../stack_queue/queue/queue.h"
 #include "../stack_queue/stack/stack.h"
 #include "ant_colony_algorithms.h"
+#include "distance_table.h"
 #include "graph.h"
+#include "lin_kernighan_algorithms.h"
+#include "path_cache.h"
+#include "shortest_path_algorithms.h"
+#include "spanning_tree_algorithms.h"
 #include "t_matrix.h"
+#include "tsp_exact_algorithms.h"
+#include "tsp_search_control.h"
 
 namespace s21 {
 class GraphAlgorithms {
  public:
-  struct TsmResult {
-    std::vector<int> vertices;
-    double distance;
+  using TsmResult = s21::TsmResult;
+
+  enum class ApspEngine { kAuto, kFloyd, kJohnson };
+  enum class MstEngine { kAuto, kBoruvka, kFilterKruskal };
+  enum class TspEngine {
+    kAuto,
+    kAntColony,
+    kHeldKarp,
+    kBranchAndBound,
+    kLinKernighan
   };
 
+  // Largest orders for which kAuto solves the salesman problem exactly and
+  // with the ant colony.
+  static constexpr size_t kExactTspOrder = 16;
+  static constexpr size_t kAntColonyTspOrder = 128;
+  // Branch and bound without a time budget stops after this long.
+  static constexpr std::chrono::seconds kBranchAndBoundTimeLimit{10};
+
   static std::vector<int> FordBellmanAlgorithm(const Graph& graph,
                                                int start_vertex);
   static std::vector<int> DepthFirstSearch(const Graph& graph,
@@ -26,19 +48,97 @@ class GraphAlgorithms {
   static std::vector<int> BreadthFirstSearch(const Graph& graph,
                                              int start_vertex);
 
+  // Uses a bucket queue (Dial) when all weights are small positive integers,
+  // a radix heap for other positive weights and the matrix Dijkstra when the
+  // graph has negative edges. Trees of positive-weight searches are kept in
+  // path_cache(), so later queries from the same source are lookups.
   static int GetShortestPathBetweenVertices(Graph& graph, int vertex1,
                                             int vertex2);
 
-  static Matrix<int> GetShortestPathsBetweenAllVertices(Graph& graph);
+  // Distances from `start_vertex` to every vertex, kInfinity for unreachable
+  // ones. Negative weights fall back to Bellman-Ford.
+  static std::vector<int> GetShortestPathsFromVertex(Graph& graph,
+                                                     int start_vertex);
+
+  // Distances and parents from `start_vertex`; PathTo() recovers a route.
+  static ShortestPathTree GetShortestPathTree(Graph& graph, int start_vertex);
+
+  // kAuto picks Johnson's algorithm for large sparse graphs and Floyd-Warshall
+  // otherwise; graphs larger than one Floyd tile use the blocked parallel
+  // variant. Both run on `threads` workers (0 - all hardware threads).
+  static Matrix<int> GetShortestPathsBetweenAllVertices(
+      Graph& graph, size_t threads = 0, ApspEngine engine = ApspEngine::kAuto);
+
+  // Row-at-a-time all-pairs shortest paths for tables that do not fit in
+  // memory; see ShortestPathAlgorithms::StreamAllPairs.
+  static void StreamShortestPathsBetweenAllVertices(
+      Graph& graph, const ShortestPathAlgorithms::RowCallback& on_row,
+      size_t threads = 0);
+
+  // Writes the all-pairs distance table to `filename` as rows complete; read
+  // it back with DistanceTableReader.
+  static void ExportShortestPathsBetweenAllVertices(
+      Graph& graph, const std::string& filename,
+      DistanceEncoding encoding = DistanceEncoding::kInt32, size_t threads = 0);
 
+  // origins.size() x targets.size() matrix of shortest distances, kInfinity
+  // where a target is unreachable.
+  static Matrix<int> GetDistanceTable(Graph& graph,
+                                      const std::vector<int>& origins,
+                                      const std::vector<int>& targets,
+                                      size_t threads = 0);
+
+  // Prim's algorithm with a binary heap on sparse graphs and a key array on
+  // dense ones.
   static Matrix<int> GetLeastSpanningTree(Graph& graph);
 
-  static TsmResult SolveTravelingSalesmanProblem(Graph& graph);
+  // The same tree as an edge list; ToMatrix() gives the dense form.
+  static SpanningTree GetLeastSpanningTreeEdges(Graph& graph);
+
+  // Unlike GetLeastSpanningTree it does not need a connected graph and spans
+  // every component. kAuto runs the parallel Boruvka when more than one thread
+  // is available and Filter-Kruskal otherwise; both return the same edges.
+  static SpanningTree GetMinimumSpanningForest(
+      Graph& graph, size_t threads = 0, MstEngine engine = MstEngine::kAuto);
+
+  static ShortestPathCache& path_cache();
+
+  // kAuto runs Held-Karp, which returns an optimal tour, on graphs of up to
+  // kExactTspOrder vertices, the ant colony on graphs of up to
+  // kAntColonyTspOrder vertices and Lin-Kernighan on larger ones.
+  // kBranchAndBound runs SolveTravelingSalesmanProblemWithBound and drops the
+  // bound. kLinKernighan is a serial iterated 3-opt search meant for large
+  // graphs. The other engines run on `threads` workers (0 - all hardware
+  // threads); a fixed `seed` gives the same ant colony tour for any number of
+  // threads. With a time budget in `control` the ant colony and Lin-Kernighan
+  // keep improving the tour until the budget is spent instead of doing a
+  // fixed amount of work. Held-Karp cannot be interrupted: it ignores the
+  // budget and the cancel flag, runs to completion and reports its optimal
+  // tour once.
+  static TsmResult SolveTravelingSalesmanProblem(
+      Graph& graph, std::optional<uint64_t> seed = std::nullopt,
+      size_t threads = 0, TspEngine engine = TspEngine::kAuto,
+      const TspSearchControl& control = TspSearchControl());
+
+  // Branch and bound from the ant colony tour, with the proven lower bound
+  // and gap; a gap of 0 means the tour is optimal. The search stops within
+  // the time budget of `control`, or after kBranchAndBoundTimeLimit when
+  // there is none, and then returns the best tour found with a positive gap.
+  // Graphs larger than TspExactAlgorithms::kBranchAndBoundMaxOrder are
+  // rejected before the colony runs.
+  static TspExactAlgorithms::BoundedResult
+  SolveTravelingSalesmanProblemWithBound(
+      Graph& graph, std::optional<uint64_t> seed = std::nullopt,
+      size_t threads = 0,
+      const TspSearchControl& control = TspSearchControl());
 
  private:
   static int DijkstraMinWeightAlgorithm(Graph& graph, int startVertex,
                                         int endVertex);
   static Matrix<int> FloydsAlgorithm(Graph& graph);
+  static bool IsSparse(const Graph& graph);
+  static ShortestPathCache::TreePtr CachedShortestPathTree(const Graph& graph,
+                                                          int start_vertex);
 };
 
 }  // namespace s21
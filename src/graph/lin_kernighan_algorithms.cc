@@ -0,0 +1,128 @@
+#include "lin_kernighan_algorithms.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "ant_colony_algorithms.h"
+#include "candidate_lists.h"
+#include "tour_construction.h"
+#include "tsp_local_search.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr size_t kFallbackIterations = 10;
+constexpr int kKickAttempts = 10;
+
+long long TourLength(const Matrix<int>& adjacency_matrix,
+                     const std::vector<int>& tour) {
+  long long length = 0;
+  for (size_t i = 0; i < tour.size(); i++) {
+    length += adjacency_matrix(tour[i], tour[(i + 1) % tour.size()]);
+  }
+  return length;
+}
+
+}  // namespace
+
+LinKernighanAlgorithms::TsmResult
+LinKernighanAlgorithms::SolveTravelingSalesmanProblem(
+    const Matrix<int>& adjacency_matrix,
+    const LinKernighanParameters& parameters, std::optional<uint64_t> seed,
+    const TspSearchControl& control) {
+  TspSearchMonitor monitor(control);
+  Xoshiro256 rng(seed ? *seed : RandomSeed());
+  std::vector<int> tour =
+      TourConstructionAlgorithms::ShortestTour(adjacency_matrix).vertices;
+  if (tour.empty() && adjacency_matrix.rows() > 1) {
+    // A short ant colony run finds tours in sparse graphs where the
+    // constructive tours get stuck. They have just failed, so the colony
+    // does not try them again.
+    AntColonyParameters fallback;
+    fallback.initial_tour = false;
+    AntColonyAlgorithms::Colony colony(adjacency_matrix.rows(),
+                                       adjacency_matrix, rng(), 1, fallback);
+    for (size_t i = 0; i < kFallbackIterations; i++) {
+      colony.LaunchIteration();
+      colony.UpdatePheromones();
+      colony.DistributeAnts();
+    }
+    tour = std::move(colony.best_ant.path);
+  }
+  if (tour.empty()) {
+    return {{}, std::numeric_limits<double>::max()};
+  }
+
+  CandidateLists candidates(adjacency_matrix, parameters.candidates);
+  TspLocalSearch search(adjacency_matrix, candidates);
+  double length = search.ThreeOpt(
+      tour, static_cast<double>(TourLength(adjacency_matrix, tour)));
+
+  std::vector<int> best = tour;
+  std::vector<int> touched;
+  // Tours this short have no room for a double bridge.
+  size_t kicks = tour.size() < 8 ? 0 : parameters.kicks;
+  bool stop = monitor.Update(best, length);
+  for (size_t kick = 0; kick < kicks && !stop; kick++) {
+    std::optional<long long> change =
+        DoubleBridge(adjacency_matrix, tour, rng, touched);
+    if (change) {
+      double kicked = search.ThreeOpt(tour, length + *change, touched);
+      if (kicked < length) {
+        length = kicked;
+        best = tour;
+      } else {
+        tour = best;
+      }
+    }
+    stop = monitor.Update(best, length);
+  }
+
+  std::rotate(best.begin(), std::find(best.begin(), best.end(), 0),
+              best.end());
+  return {std::move(best), length};
+}
+
+std::optional<long long> LinKernighanAlgorithms::DoubleBridge(
+    const Matrix<int>& adjacency_matrix, std::vector<int>& tour,
+    Xoshiro256& rng, std::vector<int>& touched) {
+  size_t n = tour.size();
+  if (n < 8) return std::nullopt;
+  size_t longest = std::min(kKickSegment, (n - 2) / 2);
+
+  // a | b1 ... bk | c1 ... cl | d becomes a | c1 ... cl | b1 ... bk | d.
+  for (int attempt = 0; attempt < kKickAttempts; attempt++) {
+    size_t start = rng() % n;
+    size_t first = 1 + rng() % longest;
+    size_t second = 1 + rng() % longest;
+    int a = tour[start];
+    int b1 = tour[(start + 1) % n];
+    int bk = tour[(start + first) % n];
+    int c1 = tour[(start + first + 1) % n];
+    int cl = tour[(start + first + second) % n];
+    int d = tour[(start + first + second + 1) % n];
+    if (!adjacency_matrix(a, c1) || !adjacency_matrix(cl, b1) ||
+        !adjacency_matrix(bk, d)) {
+      continue;
+    }
+
+    long long change = static_cast<long long>(adjacency_matrix(a, c1)) +
+                       adjacency_matrix(cl, b1) + adjacency_matrix(bk, d) -
+                       adjacency_matrix(a, b1) - adjacency_matrix(bk, c1) -
+                       adjacency_matrix(cl, d);
+    std::vector<int> blocks(first + second);
+    for (size_t k = 0; k < blocks.size(); k++) {
+      blocks[k] = tour[(start + 1 + k) % n];
+    }
+    std::rotate(blocks.begin(), blocks.begin() + first, blocks.end());
+    for (size_t k = 0; k < blocks.size(); k++) {
+      tour[(start + 1 + k) % n] = blocks[k];
+    }
+    touched = {a, b1, bk, c1, cl, d};
+    return change;
+  }
+  return std::nullopt;
+}
+
+}  // namespace s21
@@ -0,0 +1,53 @@
+#ifndef _LIN_KERNIGHAN_ALGORITHMS_H_
+#define _LIN_KERNIGHAN_ALGORITHMS_H_
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "random.h"
+#include "t_matrix.h"
+#include "tsp_search_control.h"
+
+namespace s21 {
+
+// Iterated local search in the spirit of Lin-Kernighan: the shortest
+// constructive tour (TourConstructionAlgorithms::ShortestTour) is driven
+// to a 3-opt local optimum over the `candidates` nearest neighbours of every
+// vertex (TspLocalSearch::ThreeOpt), then repeatedly kicked by a double
+// bridge and re-optimised around the kick, keeping the result only when it
+// is shorter.
+struct LinKernighanParameters {
+  size_t candidates = 10;
+  size_t kicks = 1000;
+};
+
+class LinKernighanAlgorithms {
+ public:
+  using TsmResult = s21::TsmResult;
+
+  // Longest segment moved by a kick.
+  static constexpr size_t kKickSegment = 50;
+
+  // The tour starts at vertex 0. When no tour is found the vertex list is
+  // empty and the distance is the largest double. Runs are reproducible when
+  // `seed` is given. `control` is checked after every kick, each kick
+  // counting as an iteration.
+  static TsmResult SolveTravelingSalesmanProblem(
+      const Matrix<int>& adjacency_matrix,
+      const LinKernighanParameters& parameters = LinKernighanParameters(),
+      std::optional<uint64_t> seed = std::nullopt,
+      const TspSearchControl& control = TspSearchControl());
+
+ private:
+  // Swaps two adjacent random segments of up to kKickSegment vertices if the
+  // three new edges exist. Returns the change in length and stores the
+  // endpoints of the changed edges in `touched`; nullopt if no kick applies.
+  static std::optional<long long> DoubleBridge(
+      const Matrix<int>& adjacency_matrix, std::vector<int>& tour,
+      Xoshiro256& rng, std::vector<int>& touched);
+};
+
+}  // namespace s21
+
+#endif
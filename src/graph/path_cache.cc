@@ -0,0 +1,76 @@
+#include "path_cache.h"
+
+namespace s21 {
+
+ShortestPathCache::TreePtr ShortestPathCache::Find(const Key& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it == index_.end()) {
+    stats_.misses++;
+    return nullptr;
+  }
+  stats_.hits++;
+  lru_.splice(lru_.begin(), lru_, it->second);
+  return it->second->second;
+}
+
+void ShortestPathCache::Insert(const Key& key, TreePtr tree) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it != index_.end()) {
+    stats_.bytes -= TreeBytes(*it->second->second);
+    lru_.erase(it->second);
+    index_.erase(it);
+  }
+  stats_.bytes += TreeBytes(*tree);
+  lru_.emplace_front(key, std::move(tree));
+  index_[key] = lru_.begin();
+  EvictOverBudget();
+}
+
+ShortestPathCache::TreePtr ShortestPathCache::GetOrCompute(
+    const Key& key, const std::function<ShortestPathTree()>& compute) {
+  TreePtr tree = Find(key);
+  if (!tree) {
+    tree = std::make_shared<const ShortestPathTree>(compute());
+    Insert(key, tree);
+  }
+  return tree;
+}
+
+void ShortestPathCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  lru_.clear();
+  index_.clear();
+  stats_ = Stats();
+}
+
+void ShortestPathCache::set_byte_budget(size_t byte_budget) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  byte_budget_ = byte_budget;
+  EvictOverBudget();
+}
+
+ShortestPathCache::Stats ShortestPathCache::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats stats = stats_;
+  stats.entries = lru_.size();
+  return stats;
+}
+
+size_t ShortestPathCache::TreeBytes(const ShortestPathTree& tree) {
+  return sizeof(Entry) + sizeof(ShortestPathTree) +
+         sizeof(int) * (tree.distance.size() + tree.parent.size());
+}
+
+void ShortestPathCache::EvictOverBudget() {
+  while (stats_.bytes > byte_budget_ && !lru_.empty()) {
+    const Entry& entry = lru_.back();
+    stats_.bytes -= TreeBytes(*entry.second);
+    index_.erase(entry.first);
+    lru_.pop_back();
+    stats_.evictions++;
+  }
+}
+
+}  // namespace s21
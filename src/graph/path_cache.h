@@ -0,0 +1,85 @@
+#ifndef _PATH_CACHE_H_
+#define _PATH_CACHE_H_
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "shortest_path_algorithms.h"
+
+namespace s21 {
+
+// Thread-safe LRU cache of shortest-path trees keyed by graph version,
+// algorithm and source vertex. Entries are evicted least recently used first
+// once their total size exceeds the byte budget.
+class ShortestPathCache {
+ public:
+  enum class Algorithm { kDial, kRadixHeap };
+
+  struct Key {
+    uint64_t graph_version;
+    Algorithm algorithm;
+    int source;
+
+    bool operator==(const Key& other) const {
+      return graph_version == other.graph_version &&
+             algorithm == other.algorithm && source == other.source;
+    }
+  };
+
+  struct Stats {
+    size_t hits = 0;
+    size_t misses = 0;
+    size_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+  };
+
+  using TreePtr = std::shared_ptr<const ShortestPathTree>;
+
+  static constexpr size_t kDefaultByteBudget = 64 << 20;
+
+  explicit ShortestPathCache(size_t byte_budget = kDefaultByteBudget)
+      : byte_budget_(byte_budget) {}
+
+  // Returns the cached tree or nullptr, counting a hit or a miss.
+  TreePtr Find(const Key& key);
+  void Insert(const Key& key, TreePtr tree);
+
+  // Looks the tree up and calls `compute` outside the lock on a miss.
+  TreePtr GetOrCompute(const Key& key,
+                       const std::function<ShortestPathTree()>& compute);
+
+  void Clear();
+  void set_byte_budget(size_t byte_budget);
+  Stats stats() const;
+
+  static size_t TreeBytes(const ShortestPathTree& tree);
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      uint64_t h = key.graph_version * 0x9e3779b97f4a7c15ULL;
+      h ^= static_cast<uint64_t>(key.source) * 0xc2b2ae3d27d4eb4fULL;
+      h ^= static_cast<uint64_t>(key.algorithm) + (h << 6) + (h >> 2);
+      return static_cast<size_t>(h);
+    }
+  };
+
+  using Entry = std::pair<Key, TreePtr>;
+
+  void EvictOverBudget();
+
+  mutable std::mutex mutex_;
+  std::list<Entry> lru_;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+  size_t byte_budget_;
+  Stats stats_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef _RANDOM_H_
+#define _RANDOM_H_
+
+#include <cstdint>
+#include <limits>
+#include <random>
+
+namespace s21 {
+
+// xoshiro256** generator (Blackman & Vigna). Copying is cheap, and Jump()
+// advances by 2^128 steps, so repeated jumps from one seed give independent
+// streams for parallel workers.
+class Xoshiro256 {
+ public:
+  using result_type = uint64_t;
+
+  explicit Xoshiro256(uint64_t seed = 0) {
+    for (uint64_t& word : state_) {
+      word = SplitMix64(seed);
+    }
+  }
+
+  static constexpr result_type min() { return 0; }
+  static constexpr result_type max() {
+    return std::numeric_limits<result_type>::max();
+  }
+
+  result_type operator()() {
+    const uint64_t result = Rotl(state_[1] * 5, 7) * 9;
+    const uint64_t t = state_[1] << 17;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = Rotl(state_[3], 45);
+    return result;
+  }
+
+  // Uniform double in [0, 1).
+  double NextDouble() { return ((*this)() >> 11) * 0x1.0p-53; }
+
+  void Jump() {
+    static constexpr uint64_t kJump[] = {0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+                                         0xa9582618e03fc9aa,
+                                         0x39abdc4529b1661c};
+    uint64_t jumped[4] = {0, 0, 0, 0};
+    for (uint64_t mask : kJump) {
+      for (int bit = 0; bit < 64; bit++) {
+        if (mask & uint64_t{1} << bit) {
+          for (int i = 0; i < 4; i++) jumped[i] ^= state_[i];
+        }
+        (*this)();
+      }
+    }
+    for (int i = 0; i < 4; i++) state_[i] = jumped[i];
+  }
+
+ private:
+  static uint64_t Rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+  static uint64_t SplitMix64(uint64_t& x) {
+    uint64_t z = (x += 0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    return z ^ (z >> 31);
+  }
+
+  uint64_t state_[4];
+};
+
+// Non-deterministic seed for callers that do not fix one.
+inline uint64_t RandomSeed() {
+  std::random_device device;
+  return static_cast<uint64_t>(device()) << 32 | device();
+}
+
+}  // namespace s21
+
+#endif
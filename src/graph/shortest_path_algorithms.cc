@@ -0,0 +1,376 @@
+#include "shortest_path_algorithms.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+
+namespace {
+
+// Monotone priority queue: popped keys never decrease, so an entry is kept in
+// the bucket of the highest bit in which its key differs from the last
+// popped key, and only the lowest non-empty bucket is ever redistributed.
+class RadixHeap {
+ public:
+  bool Empty() const { return size_ == 0; }
+
+  void Push(uint32_t key, int value) {
+    buckets_[BucketIndex(key)].push_back({key, value});
+    size_++;
+  }
+
+  std::pair<uint32_t, int> Pop() {
+    if (buckets_[0].empty()) {
+      size_t i = 1;
+      while (buckets_[i].empty()) i++;
+      last_ = std::min_element(buckets_[i].begin(), buckets_[i].end())->first;
+      for (const auto& entry : buckets_[i]) {
+        buckets_[BucketIndex(entry.first)].push_back(entry);
+      }
+      buckets_[i].clear();
+    }
+    std::pair<uint32_t, int> entry = buckets_[0].back();
+    buckets_[0].pop_back();
+    size_--;
+    return entry;
+  }
+
+ private:
+  size_t BucketIndex(uint32_t key) const {
+    return key == last_ ? 0 : 32 - __builtin_clz(key ^ last_);
+  }
+
+  std::vector<std::pair<uint32_t, int>> buckets_[33];
+  uint32_t last_ = 0;
+  size_t size_ = 0;
+};
+
+}  // namespace
+
+Matrix<int> ShortestPathAlgorithms::ParallelFloydWarshall(
+    const Matrix<int>& adjacency_matrix, size_t threads, size_t tile) {
+  Matrix<int> dist = InitialDistances(adjacency_matrix);
+  size_t order = dist.rows();
+  if (tile == 0) {
+    tile = kFloydTileSize;
+  }
+  size_t tiles = (order + tile - 1) / tile;
+  ThreadPool pool(threads);
+
+  for (size_t k = 0; k < tiles; k++) {
+    RelaxTile(dist, k, k, k, tile);
+
+    for (size_t t = 0; t < tiles; t++) {
+      if (t == k) continue;
+      pool.Submit([&dist, k, t, tile] { RelaxTile(dist, k, k, t, tile); });
+      pool.Submit([&dist, k, t, tile] { RelaxTile(dist, k, t, k, tile); });
+    }
+    pool.Wait();
+
+    pool.ParallelFor(0, tiles, [&dist, k, tiles, tile](size_t i) {
+      if (i == k) return;
+      for (size_t j = 0; j < tiles; j++) {
+        if (j != k) {
+          RelaxTile(dist, k, i, j, tile);
+        }
+      }
+    });
+  }
+
+  return dist;
+}
+
+Matrix<int> ShortestPathAlgorithms::Johnson(const Matrix<int>& adjacency_matrix,
+                                            size_t threads) {
+  AdjacencyList graph(adjacency_matrix);
+  std::vector<long long> potential = Potentials(graph);
+  size_t order = graph.order();
+  Matrix<int> dist(order, order);
+  int* data = dist.data();
+
+  ThreadPool pool(threads);
+  for (size_t source = 0; source < order; source++) {
+    pool.Submit([&graph, &potential, data, order, source] {
+      ReweightedDijkstra(graph, source, potential, data + source * order);
+    });
+  }
+  pool.Wait();
+
+  return dist;
+}
+
+void ShortestPathAlgorithms::StreamAllPairs(const Matrix<int>& adjacency_matrix,
+                                            const RowCallback& on_row,
+                                            size_t threads) {
+  AdjacencyList graph(adjacency_matrix);
+  std::vector<long long> potential = Potentials(graph);
+  size_t order = graph.order();
+  std::mutex callback_mutex;
+
+  ThreadPool pool(threads);
+  for (size_t source = 0; source < order; source++) {
+    pool.Submit([&graph, &potential, &on_row, &callback_mutex, order, source] {
+      thread_local std::vector<int> row;
+      row.resize(order);
+      ReweightedDijkstra(graph, source, potential, row.data());
+      std::lock_guard<std::mutex> lock(callback_mutex);
+      on_row(source, row.data());
+    });
+  }
+  pool.Wait();
+}
+
+Matrix<int> ShortestPathAlgorithms::DistanceTable(
+    const Matrix<int>& adjacency_matrix, const std::vector<int>& origins,
+    const std::vector<int>& targets, size_t threads) {
+  AdjacencyList graph(adjacency_matrix);
+  std::vector<long long> potential = Potentials(graph);
+  size_t order = graph.order();
+
+  std::vector<char> is_target(order, false);
+  size_t distinct_targets = 0;
+  for (int target : targets) {
+    if (!is_target[target]) {
+      is_target[target] = true;
+      distinct_targets++;
+    }
+  }
+
+  Matrix<int> table(origins.size(), targets.size());
+  int* data = table.data();
+  constexpr long long unreached = std::numeric_limits<long long>::max();
+
+  ThreadPool pool(threads);
+  pool.ParallelFor(0, origins.size(), [&](size_t row) {
+    using Entry = std::pair<long long, int>;
+    thread_local std::vector<long long> cost;
+    thread_local std::vector<int> touched;
+    cost.resize(order, unreached);
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+
+    int origin = origins[row];
+    size_t remaining = distinct_targets;
+    cost[origin] = 0;
+    touched.push_back(origin);
+    heap.push({0, origin});
+    while (!heap.empty() && remaining > 0) {
+      auto [vertex_cost, vertex] = heap.top();
+      heap.pop();
+      if (vertex_cost > cost[vertex]) continue;
+      if (is_target[vertex]) remaining--;
+
+      for (const AdjacencyList::Edge& edge : graph.neighbors(vertex)) {
+        long long new_cost =
+            vertex_cost + edge.weight + potential[vertex] - potential[edge.to];
+        if (new_cost < cost[edge.to]) {
+          if (cost[edge.to] == unreached) touched.push_back(edge.to);
+          cost[edge.to] = new_cost;
+          heap.push({new_cost, edge.to});
+        }
+      }
+    }
+
+    int* out = data + row * targets.size();
+    for (size_t column = 0; column < targets.size(); column++) {
+      int target = targets[column];
+      out[column] = cost[target] == unreached
+                        ? kInfinity
+                        : static_cast<int>(cost[target] - potential[origin] +
+                                           potential[target]);
+    }
+    for (int vertex : touched) {
+      cost[vertex] = unreached;
+    }
+    touched.clear();
+  });
+
+  return table;
+}
+
+std::vector<int> ShortestPathAlgorithms::Dial(const AdjacencyList& graph,
+                                              int source, int max_weight,
+                                              std::vector<int>* parent) {
+  std::vector<int> dist(graph.order(), kInfinity);
+  if (parent) parent->assign(graph.order(), -1);
+  std::vector<std::vector<int>> buckets(max_weight + 1);
+  size_t queued = 1;
+  dist[source] = 0;
+  buckets[0].push_back(source);
+
+  for (int current = 0; queued > 0; current++) {
+    std::vector<int>& bucket = buckets[current % buckets.size()];
+    while (!bucket.empty()) {
+      int vertex = bucket.back();
+      bucket.pop_back();
+      queued--;
+      if (dist[vertex] != current) continue;
+
+      for (const AdjacencyList::Edge& edge : graph.neighbors(vertex)) {
+        int new_cost = current + edge.weight;
+        if (new_cost < dist[edge.to]) {
+          dist[edge.to] = new_cost;
+          if (parent) (*parent)[edge.to] = vertex;
+          buckets[new_cost % buckets.size()].push_back(edge.to);
+          queued++;
+        }
+      }
+    }
+  }
+
+  return dist;
+}
+
+std::vector<int> ShortestPathAlgorithms::RadixHeapDijkstra(
+    const AdjacencyList& graph, int source, std::vector<int>* parent) {
+  std::vector<int> dist(graph.order(), kInfinity);
+  if (parent) parent->assign(graph.order(), -1);
+  RadixHeap heap;
+  dist[source] = 0;
+  heap.Push(0, source);
+
+  while (!heap.Empty()) {
+    auto [cost, vertex] = heap.Pop();
+    if (static_cast<int>(cost) != dist[vertex]) continue;
+
+    for (const AdjacencyList::Edge& edge : graph.neighbors(vertex)) {
+      int new_cost = dist[vertex] + edge.weight;
+      if (new_cost < dist[edge.to]) {
+        dist[edge.to] = new_cost;
+        if (parent) (*parent)[edge.to] = vertex;
+        heap.Push(new_cost, edge.to);
+      }
+    }
+  }
+
+  return dist;
+}
+
+ShortestPathTree ShortestPathAlgorithms::BellmanFordTree(
+    const AdjacencyList& graph, int source) {
+  size_t order = graph.order();
+  ShortestPathTree tree;
+  tree.source = source;
+  tree.distance.assign(order, kInfinity);
+  tree.parent.assign(order, -1);
+  tree.distance[source] = 0;
+
+  for (size_t round = 0; round < order; round++) {
+    bool changed = false;
+    for (size_t u = 0; u < order; u++) {
+      if (tree.distance[u] == kInfinity) continue;
+      for (const AdjacencyList::Edge& edge : graph.neighbors(u)) {
+        if (tree.distance[u] + edge.weight < tree.distance[edge.to]) {
+          tree.distance[edge.to] = tree.distance[u] + edge.weight;
+          tree.parent[edge.to] = u;
+          changed = true;
+        }
+      }
+    }
+    if (!changed) {
+      return tree;
+    }
+  }
+  throw std::runtime_error("Negative cycle");
+}
+
+std::vector<long long> ShortestPathAlgorithms::Potentials(
+    const AdjacencyList& graph) {
+  size_t order = graph.order();
+  std::vector<long long> potential(order, 0);
+  for (size_t round = 0; round <= order; round++) {
+    bool changed = false;
+    for (size_t u = 0; u < order; u++) {
+      for (const AdjacencyList::Edge& edge : graph.neighbors(u)) {
+        if (potential[u] + edge.weight < potential[edge.to]) {
+          potential[edge.to] = potential[u] + edge.weight;
+          changed = true;
+        }
+      }
+    }
+    if (!changed) {
+      return potential;
+    }
+  }
+  throw std::runtime_error("Negative cycle");
+}
+
+void ShortestPathAlgorithms::ReweightedDijkstra(
+    const AdjacencyList& graph, int source,
+    const std::vector<long long>& potential, int* dist) {
+  using Entry = std::pair<long long, int>;
+  size_t order = graph.order();
+  std::vector<long long> cost(order, std::numeric_limits<long long>::max());
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+
+  cost[source] = 0;
+  heap.push({0, source});
+  while (!heap.empty()) {
+    auto [vertex_cost, vertex] = heap.top();
+    heap.pop();
+    if (vertex_cost > cost[vertex]) continue;
+
+    for (const AdjacencyList::Edge& edge : graph.neighbors(vertex)) {
+      long long new_cost =
+          vertex_cost + edge.weight + potential[vertex] - potential[edge.to];
+      if (new_cost < cost[edge.to]) {
+        cost[edge.to] = new_cost;
+        heap.push({new_cost, edge.to});
+      }
+    }
+  }
+
+  for (size_t v = 0; v < order; v++) {
+    dist[v] =
+        cost[v] == std::numeric_limits<long long>::max()
+            ? kInfinity
+            : static_cast<int>(cost[v] - potential[source] + potential[v]);
+  }
+}
+
+Matrix<int> ShortestPathAlgorithms::InitialDistances(
+    const Matrix<int>& adjacency_matrix) {
+  size_t order = adjacency_matrix.rows();
+  Matrix<int> dist(order, order, kInfinity);
+  for (size_t i = 0; i < order; i++) {
+    for (size_t j = 0; j < order; j++) {
+      if (i == j) {
+        dist(i, j) = 0;
+      }
+      if (adjacency_matrix(i, j) != 0) {
+        dist(i, j) = adjacency_matrix(i, j);
+      }
+    }
+  }
+  return dist;
+}
+
+void ShortestPathAlgorithms::RelaxTile(Matrix<int>& dist, size_t pivot_tile,
+                                       size_t row_tile, size_t col_tile,
+                                       size_t tile) {
+  size_t order = dist.rows();
+  int* data = dist.data();
+  size_t k_end = std::min(order, (pivot_tile + 1) * tile);
+  size_t i_end = std::min(order, (row_tile + 1) * tile);
+  size_t j_begin = col_tile * tile;
+  size_t j_end = std::min(order, j_begin + tile);
+
+  for (size_t k = pivot_tile * tile; k < k_end; k++) {
+    const int* row_k = data + k * order;
+    for (size_t i = row_tile * tile; i < i_end; i++) {
+      int* row_i = data + i * order;
+      int d_ik = row_i[k];
+      if (d_ik == kInfinity) continue;
+      for (size_t j = j_begin; j < j_end; j++) {
+        if (row_k[j] != kInfinity && d_ik + row_k[j] < row_i[j]) {
+          row_i[j] = d_ik + row_k[j];
+        }
+      }
+    }
+  }
+}
+
+}  // namespace s21
@@ -0,0 +1,87 @@
+#ifndef _SHORTEST_PATH_ALGORITHMS_H_
+#define _SHORTEST_PATH_ALGORITHMS_H_
+
+#include <functional>
+#include <limits>
+#include <vector>
+
+#include "adjacency_list.h"
+#include "t_matrix.h"
+#include "thread_pool.h"
+#include "trees.h"
+
+namespace s21 {
+
+class ShortestPathAlgorithms {
+ public:
+  static constexpr int kInfinity = std::numeric_limits<int>::max();
+  static constexpr size_t kFloydTileSize = 64;
+  static constexpr int kDialMaxWeight = 1024;
+
+  // Receives one finished row of an all-pairs table: the distances from
+  // `source` to every vertex. The row buffer is reused after the call.
+  using RowCallback = std::function<void(int source, const int* row)>;
+
+  // Blocked Floyd-Warshall. Each round relaxes the diagonal tile, then the
+  // tiles of its row and column, then all remaining tiles; the last two
+  // phases run concurrently on `threads` workers (0 - all hardware threads).
+  static Matrix<int> ParallelFloydWarshall(const Matrix<int>& adjacency_matrix,
+                                           size_t threads = 0,
+                                           size_t tile = kFloydTileSize);
+
+  // Johnson's algorithm: Bellman-Ford potentials make every edge weight
+  // non-negative, then a heap Dijkstra runs from every source as a separate
+  // task. Throws if the graph contains a negative cycle.
+  static Matrix<int> Johnson(const Matrix<int>& adjacency_matrix,
+                             size_t threads = 0);
+
+  // Computes the same rows as Johnson() but hands each one to `on_row` as soon
+  // as it is ready instead of building the full matrix, so only one row per
+  // worker is held in memory. Calls to `on_row` are serialized; rows arrive in
+  // no particular order.
+  static void StreamAllPairs(const Matrix<int>& adjacency_matrix,
+                             const RowCallback& on_row, size_t threads = 0);
+
+  // Distances from every origin to every target as an origins x targets
+  // matrix. One Dijkstra runs per origin and stops as soon as all targets are
+  // settled; negative edges are handled through Johnson potentials.
+  static Matrix<int> DistanceTable(const Matrix<int>& adjacency_matrix,
+                                   const std::vector<int>& origins,
+                                   const std::vector<int>& targets,
+                                   size_t threads = 0);
+
+  // Single-source shortest paths for positive integer weights. Dial keeps one
+  // bucket per distance modulo (max weight + 1); the radix heap is a
+  // monotone queue for arbitrary weights. Point-to-point queries read the
+  // whole tree, which GraphAlgorithms caches per source. Unreached vertices
+  // stay at kInfinity. Predecessors are stored in `parent` when it is given.
+  static std::vector<int> Dial(const AdjacencyList& graph, int source,
+                               int max_weight,
+                               std::vector<int>* parent = nullptr);
+  static std::vector<int> RadixHeapDijkstra(const AdjacencyList& graph,
+                                            int source,
+                                            std::vector<int>* parent = nullptr);
+
+  // Bellman-Ford shortest-path tree for graphs with negative edges. Throws if
+  // a negative cycle is reachable from `source`.
+  static ShortestPathTree BellmanFordTree(const AdjacencyList& graph,
+                                          int source);
+
+  // Bellman-Ford from a virtual source joined to every vertex by a zero edge.
+  static std::vector<long long> Potentials(const AdjacencyList& graph);
+
+  // Dijkstra over the edges reweighted by `potential`. Distances are written
+  // to `dist` in the original weights, kInfinity for unreachable vertices.
+  static void ReweightedDijkstra(const AdjacencyList& graph, int source,
+                                 const std::vector<long long>& potential,
+                                 int* dist);
+
+ private:
+  static Matrix<int> InitialDistances(const Matrix<int>& adjacency_matrix);
+  static void RelaxTile(Matrix<int>& dist, size_t pivot_tile, size_t row_tile,
+                        size_t col_tile, size_t tile);
+};
+
+}  // namespace s21
+
+#endif
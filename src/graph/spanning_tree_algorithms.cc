@@ -0,0 +1,203 @@
+#include "spanning_tree_algorithms.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+
+namespace s21 {
+
+std::vector<int> SpanningTreeAlgorithms::PrimDense(
+    const Matrix<int>& adjacency_matrix) {
+  return PrimDense(adjacency_matrix.data(), adjacency_matrix.rows(), 0);
+}
+
+std::vector<int> SpanningTreeAlgorithms::PrimHeap(const AdjacencyList& graph) {
+  using Entry = std::pair<int, int>;
+  const int inf = std::numeric_limits<int>::max();
+  size_t order = graph.order();
+  std::vector<int> key(order, inf);
+  std::vector<int> parent(order, -1);
+  std::vector<bool> selected(order, false);
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap;
+
+  heap.push({0, 0});
+  while (!heap.empty()) {
+    int vertex = heap.top().second;
+    heap.pop();
+    if (selected[vertex]) continue;
+    selected[vertex] = true;
+
+    for (const AdjacencyList::Edge& edge : graph.neighbors(vertex)) {
+      if (!selected[edge.to] && edge.weight < key[edge.to]) {
+        key[edge.to] = edge.weight;
+        parent[edge.to] = vertex;
+        heap.push({edge.weight, edge.to});
+      }
+    }
+  }
+
+  return parent;
+}
+
+std::vector<WeightedEdge> SpanningTreeAlgorithms::Boruvka(
+    const Matrix<int>& adjacency_matrix, size_t threads) {
+  constexpr uint64_t none = std::numeric_limits<uint64_t>::max();
+  size_t order = adjacency_matrix.rows();
+  std::vector<WeightedEdge> edges = UndirectedEdges(adjacency_matrix);
+  std::vector<WeightedEdge> forest(order > 0 ? order - 1 : 0);
+  std::atomic<size_t> forest_size{0};
+  ConcurrentDisjointSet components(order);
+  std::vector<std::atomic<uint64_t>> cheapest(order);
+  std::vector<char> internal(edges.size());
+  ThreadPool pool(threads);
+
+  // Keys order edges by weight and then by position, so every component
+  // has a unique lightest edge and the picked edges never close a cycle.
+  auto key = [&edges](size_t index) {
+    int64_t weight = edges[index].weight;
+    return static_cast<uint64_t>(weight - std::numeric_limits<int>::min())
+               << 32 |
+           index;
+  };
+  auto offer = [&cheapest](int component, uint64_t candidate) {
+    uint64_t current = cheapest[component].load();
+    while (candidate < current &&
+           !cheapest[component].compare_exchange_weak(current, candidate)) {
+    }
+  };
+
+  while (!edges.empty()) {
+    pool.ParallelFor(0, order, [&cheapest](size_t v) { cheapest[v] = none; });
+    internal.assign(edges.size(), false);
+    pool.ParallelFor(0, edges.size(), [&](size_t i) {
+      int a = components.Find(edges[i].from);
+      int b = components.Find(edges[i].to);
+      if (a == b) {
+        internal[i] = true;
+        return;
+      }
+      offer(a, key(i));
+      offer(b, key(i));
+    });
+
+    size_t before = forest_size;
+    pool.ParallelFor(0, order, [&](size_t v) {
+      uint64_t picked = cheapest[v].load();
+      if (picked == none) return;
+      const WeightedEdge& edge = edges[picked & 0xffffffffu];
+      if (components.Unite(edge.from, edge.to)) {
+        forest[forest_size++] = edge;
+      }
+    });
+    if (forest_size == before) break;
+
+    size_t kept = 0;
+    for (size_t i = 0; i < edges.size(); i++) {
+      if (!internal[i]) edges[kept++] = edges[i];
+    }
+    edges.resize(kept);
+  }
+
+  forest.resize(forest_size);
+  std::sort(forest.begin(), forest.end(), EdgeLess);
+  return forest;
+}
+
+std::vector<WeightedEdge> SpanningTreeAlgorithms::FilterKruskal(
+    std::vector<WeightedEdge> edges, size_t order, size_t threads,
+    size_t base_case) {
+  std::vector<WeightedEdge> forest;
+  if (order == 0) {
+    return forest;
+  }
+  DisjointSet components(order);
+  ThreadPool pool(threads);
+  forest.reserve(order - 1);
+  FilterKruskalStep(edges.begin(), edges.end(), components, pool,
+                    std::max<size_t>(base_case, 3), order - 1, forest);
+  return forest;
+}
+
+void SpanningTreeAlgorithms::FilterKruskalStep(
+    EdgeIterator first, EdgeIterator last, DisjointSet& components,
+    ThreadPool& pool, size_t base_case, size_t max_edges,
+    std::vector<WeightedEdge>& forest) {
+  if (first == last || forest.size() == max_edges) {
+    return;
+  }
+  if (static_cast<size_t>(last - first) <= base_case) {
+    pool.Sort(first, last, EdgeLess);
+    for (EdgeIterator edge = first; edge != last; ++edge) {
+      if (components.Unite(edge->from, edge->to)) {
+        forest.push_back(*edge);
+      }
+    }
+    return;
+  }
+
+  // Three-way split around the median of three: edges equal to the pivot
+  // (parallel or duplicate edges) go between the halves, so each half is
+  // strictly smaller than the range even when many edges compare equal.
+  WeightedEdge candidates[3] = {*first, *(first + (last - first) / 2),
+                                *(last - 1)};
+  std::sort(candidates, candidates + 3, EdgeLess);
+  WeightedEdge pivot = candidates[1];
+
+  EdgeIterator middle = std::partition(
+      first, last,
+      [&pivot](const WeightedEdge& edge) { return EdgeLess(edge, pivot); });
+  EdgeIterator heavy = std::partition(
+      middle, last,
+      [&pivot](const WeightedEdge& edge) { return !EdgeLess(pivot, edge); });
+  FilterKruskalStep(first, middle, components, pool, base_case, max_edges,
+                    forest);
+  for (EdgeIterator edge = middle;
+       edge != heavy && forest.size() < max_edges; ++edge) {
+    if (components.Unite(edge->from, edge->to)) {
+      forest.push_back(*edge);
+    }
+  }
+
+  EdgeIterator kept = std::partition(
+      heavy, last, [&components](const WeightedEdge& edge) {
+        return components.Find(edge.from) != components.Find(edge.to);
+      });
+  FilterKruskalStep(heavy, kept, components, pool, base_case, max_edges,
+                    forest);
+}
+
+std::vector<WeightedEdge> SpanningTreeAlgorithms::UndirectedEdges(
+    const Matrix<int>& adjacency_matrix) {
+  size_t order = adjacency_matrix.rows();
+  const int* data = adjacency_matrix.data();
+  std::vector<WeightedEdge> edges;
+  for (size_t i = 0; i < order; i++) {
+    for (size_t j = i + 1; j < order; j++) {
+      int forward = data[i * order + j];
+      int backward = data[j * order + i];
+      if (forward == 0 && backward == 0) continue;
+      int weight = forward == 0    ? backward
+                   : backward == 0 ? forward
+                                   : std::min(forward, backward);
+      edges.push_back({static_cast<int>(i), static_cast<int>(j), weight});
+    }
+  }
+  return edges;
+}
+
+SpanningTree SpanningTreeAlgorithms::ParentsToTree(
+    const Matrix<int>& adjacency_matrix, const std::vector<int>& parent) {
+  SpanningTree tree{adjacency_matrix.rows(), {}};
+  for (size_t v = 0; v < parent.size(); v++) {
+    if (parent[v] >= 0) {
+      tree.edges.push_back({parent[v], static_cast<int>(v),
+                            adjacency_matrix(parent[v], v)});
+    }
+  }
+  return tree;
+}
+
+}  // namespace s21
@@ -0,0 +1,176 @@
+#ifndef _SPANNING_TREE_ALGORITHMS_H_
+#define _SPANNING_TREE_ALGORITHMS_H_
+
+#include <atomic>
+#include <limits>
+#include <vector>
+
+#include "adjacency_list.h"
+#include "t_matrix.h"
+#include "thread_pool.h"
+#include "trees.h"
+
+namespace s21 {
+
+// Union-find with path halving and union by size.
+class DisjointSet {
+ public:
+  explicit DisjointSet(size_t size) : parent_(size), size_(size, 1) {
+    for (size_t i = 0; i < size; i++) {
+      parent_[i] = i;
+    }
+  }
+
+  int Find(int vertex) {
+    while (parent_[vertex] != vertex) {
+      parent_[vertex] = parent_[parent_[vertex]];
+      vertex = parent_[vertex];
+    }
+    return vertex;
+  }
+
+  bool Unite(int a, int b) {
+    a = Find(a);
+    b = Find(b);
+    if (a == b) return false;
+    if (size_[a] < size_[b]) std::swap(a, b);
+    parent_[b] = a;
+    size_[a] += size_[b];
+    return true;
+  }
+
+ private:
+  std::vector<int> parent_;
+  std::vector<int> size_;
+};
+
+// Union-find whose Find and Unite may be called from several threads at
+// once. Roots are always linked under the lower-numbered root, so concurrent
+// links cannot form a cycle.
+class ConcurrentDisjointSet {
+ public:
+  explicit ConcurrentDisjointSet(size_t size) : parent_(size) {
+    for (size_t i = 0; i < size; i++) {
+      parent_[i].store(i, std::memory_order_relaxed);
+    }
+  }
+
+  int Find(int vertex) {
+    while (true) {
+      int parent = parent_[vertex].load();
+      if (parent == vertex) return vertex;
+      int grandparent = parent_[parent].load();
+      if (parent != grandparent) {
+        parent_[vertex].compare_exchange_weak(parent, grandparent);
+      }
+      vertex = grandparent;
+    }
+  }
+
+  // Returns false when both vertices were already in the same set.
+  bool Unite(int a, int b) {
+    while (true) {
+      a = Find(a);
+      b = Find(b);
+      if (a == b) return false;
+      if (a < b) std::swap(a, b);
+      int expected = a;
+      if (parent_[a].compare_exchange_strong(expected, b)) return true;
+    }
+  }
+
+ private:
+  std::vector<std::atomic<int>> parent_;
+};
+
+class SpanningTreeAlgorithms {
+ public:
+  static constexpr size_t kKruskalBaseCase = 1 << 14;
+
+  // Prim's algorithm grown from vertex 0. Both variants return the parent of
+  // every vertex in the tree (-1 for the root and for vertices that cannot be
+  // reached) and pick the same edges: the lightest edge to the lowest-numbered
+  // vertex first. PrimDense keeps a key array and runs in O(V^2); PrimHeap
+  // uses a binary heap and runs in O(E log V).
+  static std::vector<int> PrimDense(const Matrix<int>& adjacency_matrix);
+  // PrimDense over a row-major order x order table of any weight type, in
+  // which `none` marks a missing edge.
+  template <typename T>
+  static std::vector<int> PrimDense(const T* weights, size_t order, T none) {
+    const T inf = std::numeric_limits<T>::max();
+    std::vector<T> key(order, inf);
+    std::vector<int> parent(order, -1);
+    std::vector<bool> selected(order, false);
+
+    size_t vertex = 0;
+    for (size_t step = 0; step < order; step++) {
+      selected[vertex] = true;
+      const T* row = weights + vertex * order;
+      for (size_t j = 0; j < order; j++) {
+        if (!selected[j] && row[j] != none && row[j] < key[j]) {
+          key[j] = row[j];
+          parent[j] = vertex;
+        }
+      }
+
+      size_t next = order;
+      for (size_t j = 0; j < order; j++) {
+        if (!selected[j] && key[j] != inf &&
+            (next == order || key[j] < key[next])) {
+          next = j;
+        }
+      }
+      if (next == order) break;
+      vertex = next;
+    }
+
+    return parent;
+  }
+  static std::vector<int> PrimHeap(const AdjacencyList& graph);
+
+  // Minimum spanning forest by parallel Boruvka rounds: every component picks
+  // its lightest outgoing edge concurrently, then the picked edges are merged
+  // through a concurrent union-find. Disconnected graphs yield one tree per
+  // component. Edges come back sorted by weight.
+  static std::vector<WeightedEdge> Boruvka(const Matrix<int>& adjacency_matrix,
+                                           size_t threads = 0);
+
+  // Filter-Kruskal over an edge list: edges are split around a pivot, the
+  // light half is solved first and heavy edges already inside one component
+  // are dropped before their half is sorted. Ranges of up to `base_case`
+  // edges are sorted on the pool and scanned as in plain Kruskal. Spans every
+  // component and returns the edges sorted by weight.
+  static std::vector<WeightedEdge> FilterKruskal(
+      std::vector<WeightedEdge> edges, size_t order, size_t threads = 0,
+      size_t base_case = kKruskalBaseCase);
+
+  // Each undirected edge once, from < to, with the lighter weight of the two
+  // directions.
+  static std::vector<WeightedEdge> UndirectedEdges(
+      const Matrix<int>& adjacency_matrix);
+
+  // Edge list of the tree described by a parent array, weighted from the
+  // parent side.
+  static SpanningTree ParentsToTree(const Matrix<int>& adjacency_matrix,
+                                    const std::vector<int>& parent);
+
+  // Total order used by Boruvka and Filter-Kruskal: weight, then endpoints.
+  // With it the minimum spanning forest is unique, so both return it.
+  static bool EdgeLess(const WeightedEdge& a, const WeightedEdge& b) {
+    return a.weight != b.weight ? a.weight < b.weight
+           : a.from != b.from   ? a.from < b.from
+                                : a.to < b.to;
+  }
+
+ private:
+  using EdgeIterator = std::vector<WeightedEdge>::iterator;
+
+  static void FilterKruskalStep(EdgeIterator first, EdgeIterator last,
+                                DisjointSet& components, ThreadPool& pool,
+                                size_t base_case, size_t max_edges,
+                                std::vector<WeightedEdge>& forest);
+};
+
+}  // namespace s21
+
+#endif
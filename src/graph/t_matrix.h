@@ -66,6 +66,9 @@ class Matrix {
   size_t rows() const { return rows_; }
   size_t cols() const { return cols_; }
 
+  T *data() noexcept { return data_.data(); }
+  const T *data() const noexcept { return data_.data(); }
+
   void print() const {
     for (size_t i = 0; i < rows_; i++) {
       for (size_t j = 0; j < cols_; j++) {
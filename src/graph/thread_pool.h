@@ -0,0 +1,86 @@
+#ifndef _THREAD_POOL_H_
+#define _THREAD_POOL_H_
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace s21 {
+
+// Fixed-size pool of worker threads. Wait() blocks until every submitted task
+// has finished and rethrows the first exception thrown by a task. Tasks must
+// not call Wait() or ParallelFor() on the pool they run on.
+class ThreadPool {
+ public:
+  explicit ThreadPool(size_t num_threads = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+
+  void Submit(std::function<void()> task);
+  void Wait();
+
+  // Calls body(i) for every i in [begin, end) and waits for completion.
+  void ParallelFor(size_t begin, size_t end,
+                   const std::function<void(size_t)>& body);
+
+  // Sorts [first, last): chunks are sorted concurrently and then merged
+  // pairwise, each merge round in parallel.
+  template <typename Iterator, typename Compare>
+  void Sort(Iterator first, Iterator last, Compare compare) {
+    size_t count = last - first;
+    size_t chunks = std::min(size(), count / kMinSortChunk);
+    if (chunks < 2) {
+      std::sort(first, last, compare);
+      return;
+    }
+    std::vector<size_t> bounds(chunks + 1);
+    for (size_t i = 0; i <= chunks; i++) {
+      bounds[i] = count * i / chunks;
+    }
+    ParallelFor(0, chunks, [&](size_t i) {
+      std::sort(first + bounds[i], first + bounds[i + 1], compare);
+    });
+    for (size_t width = 1; width < chunks; width *= 2) {
+      size_t merges = (chunks + 2 * width - 1) / (2 * width);
+      ParallelFor(0, merges, [&](size_t m) {
+        size_t begin = 2 * width * m;
+        size_t middle = std::min(chunks, begin + width);
+        size_t end = std::min(chunks, begin + 2 * width);
+        if (middle < end) {
+          std::inplace_merge(first + bounds[begin], first + bounds[middle],
+                             first + bounds[end], compare);
+        }
+      });
+    }
+  }
+
+  size_t size() const { return workers_.size(); }
+
+  // Resolves 0 to the number of hardware threads.
+  static size_t ResolveThreadCount(size_t num_threads);
+
+ private:
+  static constexpr size_t kMinSortChunk = 1 << 12;
+
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;
+  std::queue<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable task_available_;
+  std::condition_variable tasks_done_;
+  size_t pending_ = 0;
+  bool stop_ = false;
+  std::exception_ptr error_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,144 @@
+#include "tour_construction.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "candidate_lists.h"
+#include "spanning_tree_algorithms.h"
+
+namespace s21 {
+
+TourConstructionAlgorithms::TsmResult
+TourConstructionAlgorithms::NearestNeighbor(
+    const Matrix<int>& adjacency_matrix) {
+  size_t order = adjacency_matrix.rows();
+  if (order == 0) return Finish(adjacency_matrix, {});
+  std::vector<int> tour{0};
+  std::vector<char> visited(order, 0);
+  visited[0] = 1;
+  while (tour.size() < order) {
+    const int* row = adjacency_matrix.data() + tour.back() * order;
+    int next = -1;
+    for (size_t v = 0; v < order; v++) {
+      if (!visited[v] && row[v] && (next == -1 || row[v] < row[next])) {
+        next = v;
+      }
+    }
+    if (next == -1) return Finish(adjacency_matrix, {});
+    visited[next] = 1;
+    tour.push_back(next);
+  }
+  return Finish(adjacency_matrix, std::move(tour));
+}
+
+TourConstructionAlgorithms::TsmResult TourConstructionAlgorithms::GreedyEdge(
+    const Matrix<int>& adjacency_matrix) {
+  size_t order = adjacency_matrix.rows();
+  CandidateLists candidates(adjacency_matrix, kGreedyCandidates);
+  std::vector<WeightedEdge> edges;
+  edges.reserve(order * kGreedyCandidates);
+  for (size_t from = 0; from < order; from++) {
+    for (int to : candidates.neighbors(from)) {
+      edges.push_back({static_cast<int>(from), to, adjacency_matrix(from, to)});
+    }
+  }
+  std::sort(edges.begin(), edges.end(), SpanningTreeAlgorithms::EdgeLess);
+
+  // The chosen edges always form vertex-disjoint paths.
+  std::vector<int> next(order, -1);
+  std::vector<int> previous(order, -1);
+  DisjointSet paths(order);
+  for (const WeightedEdge& edge : edges) {
+    if (next[edge.from] == -1 && previous[edge.to] == -1 &&
+        paths.Unite(edge.from, edge.to)) {
+      next[edge.from] = edge.to;
+      previous[edge.to] = edge.from;
+    }
+  }
+
+  // Chain the paths, always continuing with the nearest unused path start.
+  std::vector<int> starts;
+  for (size_t v = 0; v < order; v++) {
+    if (previous[v] == -1) starts.push_back(v);
+  }
+  std::vector<int> tour;
+  tour.reserve(order);
+  std::vector<char> used(starts.size(), 0);
+  size_t current = 0;
+  while (current < starts.size()) {
+    used[current] = 1;
+    for (int v = starts[current]; v != -1; v = next[v]) {
+      tour.push_back(v);
+    }
+    const int* row = adjacency_matrix.data() + tour.back() * order;
+    size_t nearest = starts.size();
+    for (size_t i = 0; i < starts.size(); i++) {
+      if (!used[i] && row[starts[i]] &&
+          (nearest == starts.size() ||
+           row[starts[i]] < row[starts[nearest]])) {
+        nearest = i;
+      }
+    }
+    if (nearest == starts.size() && tour.size() < order) {
+      return Finish(adjacency_matrix, {});
+    }
+    current = nearest;
+  }
+  return Finish(adjacency_matrix, std::move(tour));
+}
+
+TourConstructionAlgorithms::TsmResult TourConstructionAlgorithms::DoubleTree(
+    const Matrix<int>& adjacency_matrix) {
+  size_t order = adjacency_matrix.rows();
+  std::vector<int> parent = SpanningTreeAlgorithms::PrimDense(adjacency_matrix);
+  std::vector<std::vector<int>> children(order);
+  for (size_t v = 1; v < order; v++) {
+    if (parent[v] == -1) return Finish(adjacency_matrix, {});
+    children[parent[v]].push_back(v);
+  }
+
+  std::vector<int> tour;
+  tour.reserve(order);
+  std::vector<int> stack;
+  if (order > 0) stack.push_back(0);
+  while (!stack.empty()) {
+    int vertex = stack.back();
+    stack.pop_back();
+    tour.push_back(vertex);
+    stack.insert(stack.end(), children[vertex].rbegin(),
+                 children[vertex].rend());
+  }
+  return Finish(adjacency_matrix, std::move(tour));
+}
+
+TourConstructionAlgorithms::TsmResult
+TourConstructionAlgorithms::ShortestTour(const Matrix<int>& adjacency_matrix) {
+  TsmResult best = NearestNeighbor(adjacency_matrix);
+  for (TsmResult tour :
+       {GreedyEdge(adjacency_matrix), DoubleTree(adjacency_matrix)}) {
+    if (tour.distance < best.distance) {
+      best = std::move(tour);
+    }
+  }
+  return best;
+}
+
+TourConstructionAlgorithms::TsmResult TourConstructionAlgorithms::Finish(
+    const Matrix<int>& adjacency_matrix, std::vector<int> tour) {
+  size_t order = adjacency_matrix.rows();
+  if (order < 2 || tour.size() != order) {
+    return {{}, std::numeric_limits<double>::max()};
+  }
+  long long length = 0;
+  for (size_t i = 0; i < order; i++) {
+    int weight = adjacency_matrix(tour[i], tour[(i + 1) % order]);
+    if (!weight) return {{}, std::numeric_limits<double>::max()};
+    length += weight;
+  }
+  std::rotate(tour.begin(), std::find(tour.begin(), tour.end(), 0),
+              tour.end());
+  return {std::move(tour), static_cast<double>(length)};
+}
+
+}  // namespace s21
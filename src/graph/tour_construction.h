@@ -0,0 +1,43 @@
+#ifndef _TOUR_CONSTRUCTION_H_
+#define _TOUR_CONSTRUCTION_H_
+
+#include <vector>
+
+#include "t_matrix.h"
+#include "tsp_search_control.h"
+
+namespace s21 {
+
+// Quick constructive tours used as starting points and fallbacks by the
+// iterative solvers. Every method returns a closed tour that starts at
+// vertex 0 and uses existing edges only; when it gets stuck the vertex list
+// is empty and the distance is the largest double.
+class TourConstructionAlgorithms {
+ public:
+  using TsmResult = s21::TsmResult;
+
+  // Edges per vertex GreedyEdge starts from.
+  static constexpr size_t kGreedyCandidates = 10;
+
+  // Always moves to the nearest unvisited vertex, O(V^2).
+  static TsmResult NearestNeighbor(const Matrix<int>& adjacency_matrix);
+  // Takes the lightest edges among the kGreedyCandidates nearest neighbours
+  // of every vertex that keep the chosen edges a set of paths, then chains
+  // the paths nearest end first, O(V k log(V k)) plus the chaining.
+  static TsmResult GreedyEdge(const Matrix<int>& adjacency_matrix);
+  // Preorder walk of the minimum spanning tree grown from vertex 0, taking
+  // shortcuts past visited vertices; at most twice the optimum on metric
+  // graphs, O(V^2).
+  static TsmResult DoubleTree(const Matrix<int>& adjacency_matrix);
+  // The shortest of the three.
+  static TsmResult ShortestTour(const Matrix<int>& adjacency_matrix);
+
+ private:
+  // Closes `tour`, rotates it to start at vertex 0 and measures it.
+  static TsmResult Finish(const Matrix<int>& adjacency_matrix,
+                         std::vector<int> tour);
+};
+
+}  // namespace s21
+
+#endif
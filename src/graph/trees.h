@@ -0,0 +1,81 @@
+#ifndef _TREES_H_
+#define _TREES_H_
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+#include "t_matrix.h"
+
+namespace s21 {
+
+struct WeightedEdge {
+  int from;
+  int to;
+  int weight;
+};
+
+// Spanning tree or forest of a graph with `order` vertices as a list of its
+// edges: O(V) memory instead of the V x V matrix of GetLeastSpanningTree.
+struct SpanningTree {
+  size_t order = 0;
+  std::vector<WeightedEdge> edges;
+
+  long long weight() const {
+    long long total = 0;
+    for (const WeightedEdge& edge : edges) {
+      total += edge.weight;
+    }
+    return total;
+  }
+
+  // Symmetric matrix in the format returned by GetLeastSpanningTree.
+  Matrix<int> ToMatrix() const {
+    Matrix<int> matrix(order, order);
+    for (const WeightedEdge& edge : edges) {
+      matrix(edge.from, edge.to) = edge.weight;
+      matrix(edge.to, edge.from) = edge.weight;
+    }
+    return matrix;
+  }
+};
+
+// Distances from one source together with the predecessor of every vertex on
+// its shortest path; parent is -1 for the source and unreached vertices.
+struct ShortestPathTree {
+  static constexpr int kInfinity = std::numeric_limits<int>::max();
+
+  int source = -1;
+  std::vector<int> distance;
+  std::vector<int> parent;
+
+  // Vertices from the source to `target`, empty when it is unreachable.
+  std::vector<int> PathTo(int target) const {
+    std::vector<int> path;
+    if (distance[target] == kInfinity) {
+      return path;
+    }
+    for (int vertex = target; vertex != -1 && path.size() <= parent.size();
+         vertex = parent[vertex]) {
+      path.push_back(vertex);
+    }
+    std::reverse(path.begin(), path.end());
+    return path;
+  }
+
+  // Adjacency matrix of the tree edges, parent -> child, weighted by the
+  // edge length.
+  Matrix<int> ToMatrix() const {
+    Matrix<int> matrix(parent.size(), parent.size());
+    for (size_t v = 0; v < parent.size(); v++) {
+      if (parent[v] >= 0) {
+        matrix(parent[v], v) = distance[v] - distance[parent[v]];
+      }
+    }
+    return matrix;
+  }
+};
+
+}  // namespace s21
+
+#endif
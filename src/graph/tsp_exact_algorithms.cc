@@ -0,0 +1,629 @@
+#include "tsp_exact_algorithms.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "spanning_tree_algorithms.h"
+
+namespace s21 {
+
+namespace {
+
+constexpr double kNoEdge = std::numeric_limits<double>::infinity();
+constexpr long long kNoTour = std::numeric_limits<long long>::max();
+constexpr int kSubgradientIterations = 100;
+// Cost of a missing edge in the assignment problem. Tours of up to
+// kBranchAndBoundMaxOrder int weights stay below half of it, so an
+// assignment that needs a missing edge is recognised.
+constexpr long long kMissingArc = 1LL << 40;
+
+// Shared state of one branch and bound run.
+class BranchAndBoundSearch {
+ public:
+  BranchAndBoundSearch(const Matrix<int>& adjacency_matrix,
+                       std::chrono::milliseconds time_limit,
+                       const std::atomic<bool>* cancel)
+      : order_(adjacency_matrix.rows()),
+        weights_(adjacency_matrix.data()),
+        lighter_(order_ * order_, kNoEdge),
+        penalty_(order_, 0.0),
+        symmetric_(true),
+        has_deadline_(time_limit.count() > 0),
+        deadline_(std::chrono::steady_clock::now() + time_limit),
+        cancel_(cancel) {
+    for (size_t i = 0; i < order_; i++) {
+      for (size_t j = 0; j < order_; j++) {
+        int forward = Weight(i, j);
+        int backward = Weight(j, i);
+        if (forward != backward) symmetric_ = false;
+        if (i == j || (!forward && !backward)) continue;
+        lighter_[i * order_ + j] = !forward    ? backward
+                                   : !backward ? forward
+                                               : std::min(forward, backward);
+      }
+    }
+  }
+
+  // Accepts `tour` as the first upper bound if it is a valid closed tour.
+  void SetInitialTour(const std::vector<int>& tour);
+  TspExactAlgorithms::BoundedResult Run(size_t threads);
+
+ private:
+  struct Node {
+    std::vector<int> path;
+    long long cost;
+    double bound;
+  };
+
+  struct WorkQueue {
+    std::mutex mutex;
+    std::deque<Node> nodes;
+  };
+
+  int Weight(size_t from, size_t to) const {
+    return weights_[from * order_ + to];
+  }
+  double Lighter(size_t a, size_t b) const { return lighter_[a * order_ + b]; }
+
+  // Subgradient optimisation of the Held-Karp penalties; returns the best
+  // 1-tree bound found.
+  double ComputePenalties();
+  // Minimum 1-tree with vertex 0 as the special vertex under the current
+  // penalties, minus twice their sum. Fills the vertex degrees.
+  double OneTree(std::vector<int>& degree) const;
+  // The larger of the 1-tree bound below and, on directed graphs, the
+  // assignment bound.
+  double Bound(const std::vector<int>& path, long long cost) const;
+  double TreeBound(const std::vector<int>& path, long long cost,
+                   const std::vector<int>& unvisited) const;
+  // Every vertex of the completion but 0 leaves once and every vertex but
+  // `last` is entered once, so the completion is an assignment of
+  // {last} + unvisited to unvisited + {0}. Solved by the Hungarian method in
+  // O(k^3) for k unvisited vertices.
+  double AssignmentBound(long long cost, int last,
+                         const std::vector<int>& unvisited) const;
+  bool Expired() const {
+    return (cancel_ && cancel_->load()) ||
+           (has_deadline_ && std::chrono::steady_clock::now() >= deadline_);
+  }
+  bool Prunes(double bound) const {
+    return bound == kNoEdge ||
+           std::ceil(bound - 1e-6) >= static_cast<double>(best_length_.load());
+  }
+
+  void Work(size_t worker);
+  bool Pop(size_t worker, Node& node);
+  void Expand(size_t worker, const Node& node);
+  void OfferTour(const std::vector<int>& tour, long long length);
+
+  size_t order_;
+  const int* weights_;
+  std::vector<double> lighter_;
+  std::vector<double> penalty_;
+  std::vector<WorkQueue> queues_;
+  std::atomic<size_t> pending_{0};
+  std::atomic<bool> stop_{false};
+  std::atomic<long long> best_length_{kNoTour};
+  std::mutex best_mutex_;
+  std::vector<int> best_tour_;
+  double open_bound_ = kNoEdge;
+  bool symmetric_;
+  bool has_deadline_;
+  std::chrono::steady_clock::time_point deadline_;
+  const std::atomic<bool>* cancel_;
+};
+
+void BranchAndBoundSearch::SetInitialTour(const std::vector<int>& tour) {
+  if (tour.size() != order_) return;
+  std::vector<char> seen(order_, 0);
+  long long length = 0;
+  for (size_t i = 0; i < order_; i++) {
+    int from = tour[i];
+    int to = tour[(i + 1) % order_];
+    if (from < 0 || static_cast<size_t>(from) >= order_ || seen[from] ||
+        to < 0 || static_cast<size_t>(to) >= order_ || !Weight(from, to)) {
+      return;
+    }
+    seen[from] = 1;
+    length += Weight(from, to);
+  }
+  std::vector<int> rotated(tour);
+  std::rotate(rotated.begin(),
+              std::find(rotated.begin(), rotated.end(), 0), rotated.end());
+  OfferTour(rotated, length);
+}
+
+TspExactAlgorithms::BoundedResult BranchAndBoundSearch::Run(size_t threads) {
+  double root_bound = order_ >= 3 ? ComputePenalties() : -kNoEdge;
+  Node root{{0}, 0, 0.0};
+  root.bound = std::max(root_bound, Bound(root.path, 0));
+
+  ThreadPool pool(threads);
+  queues_ = std::vector<WorkQueue>(pool.size());
+  if (!Prunes(root.bound)) {
+    pending_ = 1;
+    queues_[0].nodes.push_back(std::move(root));
+  }
+  for (size_t worker = 0; worker < pool.size(); worker++) {
+    pool.Submit([this, worker] { Work(worker); });
+  }
+  pool.Wait();
+
+  long long best = best_length_.load();
+  double distance = best == kNoTour ? std::numeric_limits<double>::max()
+                                    : static_cast<double>(best);
+  double lower_bound = distance;
+  if (stop_) {
+    for (WorkQueue& queue : queues_) {
+      for (const Node& node : queue.nodes) {
+        open_bound_ = std::min(open_bound_, node.bound);
+      }
+    }
+    lower_bound = std::min(distance, open_bound_);
+  }
+  double gap = distance == lower_bound
+                   ? 0.0
+                   : (distance - lower_bound) / std::abs(distance);
+  return {{std::move(best_tour_), distance}, lower_bound, gap};
+}
+
+double BranchAndBoundSearch::ComputePenalties() {
+  std::vector<int> degree(order_);
+  std::vector<double> best_penalty = penalty_;
+  double best_bound = -kNoEdge;
+  double step = 2.0;
+  int stalled = 0;
+  for (int iteration = 0; iteration < kSubgradientIterations; iteration++) {
+    double bound = OneTree(degree);
+    if (bound == kNoEdge) {
+      return kNoEdge;
+    }
+    if (bound > best_bound) {
+      best_bound = bound;
+      best_penalty = penalty_;
+      stalled = 0;
+    } else if (++stalled == 10) {
+      step /= 2;
+      stalled = 0;
+    }
+
+    double norm = 0.0;
+    for (size_t v = 0; v < order_; v++) {
+      norm += (degree[v] - 2) * (degree[v] - 2);
+    }
+    // Without a tour to aim at, aim a little above the current bound.
+    long long best = best_length_.load();
+    double target = best != kNoTour
+                        ? static_cast<double>(best)
+                        : bound + std::max(1.0, std::abs(bound) * 0.05);
+    if (norm == 0.0 || target <= bound) {
+      break;
+    }
+    double t = step * (target - bound) / norm;
+    for (size_t v = 0; v < order_; v++) {
+      penalty_[v] += t * (degree[v] - 2);
+    }
+  }
+  penalty_ = best_penalty;
+  return best_bound;
+}
+
+double BranchAndBoundSearch::OneTree(std::vector<int>& degree) const {
+  // Minimum spanning tree of vertices 1..n-1.
+  size_t rest = order_ - 1;
+  std::vector<double> table(rest * rest);
+  for (size_t i = 0; i < rest; i++) {
+    for (size_t j = 0; j < rest; j++) {
+      double weight = Lighter(i + 1, j + 1);
+      table[i * rest + j] = weight == kNoEdge
+                                ? kNoEdge
+                                : weight + penalty_[i + 1] + penalty_[j + 1];
+    }
+  }
+  std::vector<int> parent =
+      SpanningTreeAlgorithms::PrimDense(table.data(), rest, kNoEdge);
+
+  std::fill(degree.begin(), degree.end(), 0);
+  double total = 0.0;
+  for (size_t i = 1; i < rest; i++) {
+    if (parent[i] == -1) return kNoEdge;
+    total += table[parent[i] * rest + i];
+    degree[i + 1]++;
+    degree[parent[i] + 1]++;
+  }
+
+  // Plus the two lightest edges of vertex 0.
+  double first = kNoEdge;
+  double second = kNoEdge;
+  size_t first_vertex = 0;
+  size_t second_vertex = 0;
+  for (size_t v = 1; v < order_; v++) {
+    if (Lighter(0, v) == kNoEdge) continue;
+    double weight = Lighter(0, v) + penalty_[0] + penalty_[v];
+    if (weight < first) {
+      second = first;
+      second_vertex = first_vertex;
+      first = weight;
+      first_vertex = v;
+    } else if (weight < second) {
+      second = weight;
+      second_vertex = v;
+    }
+  }
+  if (second == kNoEdge) return kNoEdge;
+  total += first + second;
+  degree[0] = 2;
+  degree[first_vertex]++;
+  degree[second_vertex]++;
+
+  for (size_t v = 0; v < order_; v++) {
+    total -= 2 * penalty_[v];
+  }
+  return total;
+}
+
+double BranchAndBoundSearch::Bound(const std::vector<int>& path,
+                                   long long cost) const {
+  thread_local std::vector<int> unvisited;
+  thread_local std::vector<char> visited;
+  visited.assign(order_, 0);
+  for (int vertex : path) {
+    visited[vertex] = 1;
+  }
+  unvisited.clear();
+  for (size_t v = 0; v < order_; v++) {
+    if (!visited[v]) unvisited.push_back(v);
+  }
+
+  int last = path.back();
+  if (unvisited.empty()) {
+    return Weight(last, 0) ? static_cast<double>(cost + Weight(last, 0))
+                           : kNoEdge;
+  }
+  double bound = TreeBound(path, cost, unvisited);
+  if (symmetric_ || bound == kNoEdge) {
+    return bound;
+  }
+  return std::max(bound, AssignmentBound(cost, path.back(), unvisited));
+}
+
+double BranchAndBoundSearch::TreeBound(const std::vector<int>& path,
+                                       long long cost,
+                                       const std::vector<int>& unvisited)
+    const {
+  // Any completion runs from the last vertex through every unvisited vertex
+  // to 0. Without its two end edges it is a spanning tree of the unvisited
+  // vertices, so it costs at least the tree plus the cheapest end edges.
+  // Penalties shift every completion by the same amount and keep this valid.
+  thread_local std::vector<double> table;
+  int last = path.back();
+  double enter = kNoEdge;
+  double leave = kNoEdge;
+  double penalties = 0.0;
+  for (int u : unvisited) {
+    if (Weight(last, u)) enter = std::min(enter, Weight(last, u) + penalty_[u]);
+    if (Weight(u, 0)) leave = std::min(leave, Weight(u, 0) + penalty_[u]);
+    penalties += penalty_[u];
+  }
+  if (enter == kNoEdge || leave == kNoEdge) return kNoEdge;
+
+  size_t count = unvisited.size();
+  table.resize(count * count);
+  for (size_t i = 0; i < count; i++) {
+    for (size_t j = 0; j < count; j++) {
+      double weight = Lighter(unvisited[i], unvisited[j]);
+      table[i * count + j] =
+          weight == kNoEdge
+              ? kNoEdge
+              : weight + penalty_[unvisited[i]] + penalty_[unvisited[j]];
+    }
+  }
+  std::vector<int> parent =
+      SpanningTreeAlgorithms::PrimDense(table.data(), count, kNoEdge);
+  double tree = 0.0;
+  for (size_t i = 1; i < count; i++) {
+    if (parent[i] == -1) return kNoEdge;
+    tree += table[parent[i] * count + i];
+  }
+  return cost + tree + enter + leave - 2 * penalties;
+}
+
+double BranchAndBoundSearch::AssignmentBound(
+    long long cost, int last, const std::vector<int>& unvisited) const {
+  // Row 0 is `last`, column 0 is vertex 0 and both are followed by the
+  // unvisited vertices. Potentials and the matching use one extra slot at
+  // index 0, as in the usual statement of the method.
+  size_t size = unvisited.size() + 1;
+  auto row_vertex = [&](size_t i) { return i == 1 ? last : unvisited[i - 2]; };
+  auto column_vertex = [&](size_t j) { return j == 1 ? 0 : unvisited[j - 2]; };
+  // `last` may only return to 0 once every vertex is visited.
+  auto arc = [&](size_t i, size_t j) -> long long {
+    int from = row_vertex(i);
+    int to = column_vertex(j);
+    if ((i == 1 && j == 1) || from == to || !Weight(from, to)) {
+      return kMissingArc;
+    }
+    return Weight(from, to);
+  };
+
+  thread_local std::vector<long long> row_potential;
+  thread_local std::vector<long long> column_potential;
+  thread_local std::vector<long long> slack;
+  thread_local std::vector<size_t> match;
+  thread_local std::vector<size_t> way;
+  thread_local std::vector<char> used;
+  row_potential.assign(size + 1, 0);
+  column_potential.assign(size + 1, 0);
+  match.assign(size + 1, 0);
+  way.assign(size + 1, 0);
+  constexpr long long kUnbounded = std::numeric_limits<long long>::max();
+  for (size_t i = 1; i <= size; i++) {
+    match[0] = i;
+    size_t column = 0;
+    slack.assign(size + 1, kUnbounded);
+    used.assign(size + 1, 0);
+    do {
+      used[column] = 1;
+      size_t row = match[column];
+      size_t next = 0;
+      long long delta = kUnbounded;
+      for (size_t j = 1; j <= size; j++) {
+        if (used[j]) continue;
+        long long reduced =
+            arc(row, j) - row_potential[row] - column_potential[j];
+        if (reduced < slack[j]) {
+          slack[j] = reduced;
+          way[j] = column;
+        }
+        if (slack[j] < delta) {
+          delta = slack[j];
+          next = j;
+        }
+      }
+      for (size_t j = 0; j <= size; j++) {
+        if (used[j]) {
+          row_potential[match[j]] += delta;
+          column_potential[j] -= delta;
+        } else {
+          slack[j] -= delta;
+        }
+      }
+      column = next;
+    } while (match[column] != 0);
+    do {
+      size_t previous = way[column];
+      match[column] = match[previous];
+      column = previous;
+    } while (column != 0);
+  }
+
+  long long assignment = -column_potential[0];
+  if (assignment >= kMissingArc / 2) {
+    return kNoEdge;
+  }
+  return static_cast<double>(cost + assignment);
+}
+
+void BranchAndBoundSearch::Work(size_t worker) {
+  Node node;
+  while (!stop_) {
+    if (!Pop(worker, node)) {
+      if (pending_ == 0) return;
+      std::this_thread::yield();
+      continue;
+    }
+    if (Expired()) {
+      stop_ = true;
+      std::lock_guard<std::mutex> lock(best_mutex_);
+      open_bound_ = std::min(open_bound_, node.bound);
+    } else if (!Prunes(node.bound)) {
+      Expand(worker, node);
+    }
+    pending_--;
+  }
+}
+
+bool BranchAndBoundSearch::Pop(size_t worker, Node& node) {
+  {
+    WorkQueue& own = queues_[worker];
+    std::lock_guard<std::mutex> lock(own.mutex);
+    if (!own.nodes.empty()) {
+      node = std::move(own.nodes.back());
+      own.nodes.pop_back();
+      return true;
+    }
+  }
+  // Steals the oldest, shallowest node of another worker.
+  for (size_t k = 1; k < queues_.size(); k++) {
+    WorkQueue& other = queues_[(worker + k) % queues_.size()];
+    std::lock_guard<std::mutex> lock(other.mutex);
+    if (!other.nodes.empty()) {
+      node = std::move(other.nodes.front());
+      other.nodes.pop_front();
+      return true;
+    }
+  }
+  return false;
+}
+
+void BranchAndBoundSearch::Expand(size_t worker, const Node& node) {
+  std::vector<char> visited(order_, 0);
+  for (int vertex : node.path) {
+    visited[vertex] = 1;
+  }
+
+  int last = node.path.back();
+  std::vector<Node> children;
+  for (size_t u = 0; u < order_; u++) {
+    if (visited[u] || !Weight(last, u)) continue;
+    Node child{node.path, node.cost + Weight(last, u), 0.0};
+    child.path.push_back(u);
+    if (child.path.size() == order_) {
+      if (Weight(u, 0)) OfferTour(child.path, child.cost + Weight(u, 0));
+      continue;
+    }
+    child.bound = Bound(child.path, child.cost);
+    if (!Prunes(child.bound)) {
+      children.push_back(std::move(child));
+    }
+  }
+
+  // The most promising child ends up at the back and is explored first.
+  std::sort(children.begin(), children.end(),
+            [](const Node& a, const Node& b) { return a.bound > b.bound; });
+  pending_ += children.size();
+  WorkQueue& own = queues_[worker];
+  std::lock_guard<std::mutex> lock(own.mutex);
+  for (Node& child : children) {
+    own.nodes.push_back(std::move(child));
+  }
+}
+
+void BranchAndBoundSearch::OfferTour(const std::vector<int>& tour,
+                                     long long length) {
+  std::lock_guard<std::mutex> lock(best_mutex_);
+  if (length < best_length_) {
+    best_length_ = length;
+    best_tour_ = tour;
+  }
+}
+
+}  // namespace
+
+TspExactAlgorithms::TsmResult TspExactAlgorithms::HeldKarp(
+    const Matrix<int>& adjacency_matrix, size_t threads) {
+  size_t order = adjacency_matrix.rows();
+  if (order > kHeldKarpMaxOrder) {
+    throw std::runtime_error("Graph is too large for Held-Karp");
+  }
+  if (order < 2) {
+    return {{}, std::numeric_limits<double>::max()};
+  }
+
+  const int* weights = adjacency_matrix.data();
+  long long bound = 0;
+  for (size_t i = 0; i < order * order; i++) {
+    bound = std::max(bound, std::llabs(weights[i]));
+  }
+  bound *= order;
+
+  ThreadPool pool(threads);
+  if (bound < std::numeric_limits<int32_t>::max() / 2) {
+    return HeldKarpTable<int32_t>(adjacency_matrix, pool);
+  }
+  return HeldKarpTable<int64_t>(adjacency_matrix, pool);
+}
+
+TspExactAlgorithms::BoundedResult TspExactAlgorithms::BranchAndBound(
+    const Matrix<int>& adjacency_matrix, const std::vector<int>& initial_tour,
+    std::chrono::milliseconds time_limit, size_t threads,
+    const std::atomic<bool>* cancel) {
+  size_t order = adjacency_matrix.rows();
+  if (order > kBranchAndBoundMaxOrder) {
+    throw std::runtime_error("Graph is too large for branch and bound");
+  }
+  if (order < 2) {
+    double none = std::numeric_limits<double>::max();
+    return {{{}, none}, none, 0.0};
+  }
+
+  BranchAndBoundSearch search(adjacency_matrix, time_limit, cancel);
+  search.SetInitialTour(initial_tour);
+  return search.Run(threads);
+}
+
+template <typename Cost>
+TspExactAlgorithms::TsmResult TspExactAlgorithms::HeldKarpTable(
+    const Matrix<int>& adjacency_matrix, ThreadPool& pool) {
+  constexpr Cost kInfinity = std::numeric_limits<Cost>::max();
+  constexpr size_t kBlock = 1 << 12;
+
+  // cost[subset * m + j] is the length of the shortest path that starts at
+  // vertex 0, visits exactly the vertices of `subset` and ends at j + 1.
+  size_t order = adjacency_matrix.rows();
+  size_t m = order - 1;
+  size_t subsets = size_t{1} << m;
+  const int* weights = adjacency_matrix.data();
+  auto weight = [weights, order](size_t from, size_t to) {
+    return weights[from * order + to];
+  };
+
+  std::vector<Cost> cost(subsets * m, kInfinity);
+  for (size_t j = 0; j < m; j++) {
+    if (weight(0, j + 1)) {
+      cost[(size_t{1} << j) * m + j] = weight(0, j + 1);
+    }
+  }
+
+  size_t blocks = (subsets + kBlock - 1) / kBlock;
+  for (size_t size = 2; size <= m; size++) {
+    pool.ParallelFor(0, blocks, [&](size_t block) {
+      size_t last = std::min(subsets, (block + 1) * kBlock);
+      for (size_t subset = block * kBlock; subset < last; subset++) {
+        if (static_cast<size_t>(__builtin_popcountll(subset)) != size) {
+          continue;
+        }
+        for (size_t j = 0; j < m; j++) {
+          if (!(subset >> j & 1)) continue;
+          const Cost* previous = &cost[(subset ^ size_t{1} << j) * m];
+          Cost best = kInfinity;
+          for (size_t k = 0; k < m; k++) {
+            int edge = weight(k + 1, j + 1);
+            if (previous[k] != kInfinity && edge) {
+              best = std::min<Cost>(best, previous[k] + edge);
+            }
+          }
+          cost[subset * m + j] = best;
+        }
+      }
+    });
+  }
+
+  size_t full = subsets - 1;
+  Cost length = kInfinity;
+  size_t end = m;
+  for (size_t j = 0; j < m; j++) {
+    int edge = weight(j + 1, 0);
+    Cost path = cost[full * m + j];
+    if (path != kInfinity && edge && path + edge < length) {
+      length = path + edge;
+      end = j;
+    }
+  }
+  if (end == m) {
+    return {{}, std::numeric_limits<double>::max()};
+  }
+
+  // Walks back through the table, picking any predecessor that explains the
+  // stored cost.
+  std::vector<int> tour;
+  tour.reserve(order);
+  size_t subset = full;
+  while (true) {
+    tour.push_back(static_cast<int>(end + 1));
+    size_t rest = subset ^ size_t{1} << end;
+    if (rest == 0) break;
+    for (size_t k = 0; k < m; k++) {
+      Cost path = cost[rest * m + k];
+      int edge = weight(k + 1, end + 1);
+      if (path != kInfinity && edge && path + edge == cost[subset * m + end]) {
+        end = k;
+        break;
+      }
+    }
+    subset = rest;
+  }
+  tour.push_back(0);
+  std::reverse(tour.begin(), tour.end());
+  return {std::move(tour), static_cast<double>(length)};
+}
+
+}  // namespace s21
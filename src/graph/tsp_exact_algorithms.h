@@ -0,0 +1,65 @@
+#ifndef _TSP_EXACT_ALGORITHMS_H_
+#define _TSP_EXACT_ALGORITHMS_H_
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include "t_matrix.h"
+#include "thread_pool.h"
+#include "tsp_search_control.h"
+
+namespace s21 {
+
+// Solvers that return a shortest closed tour through every vertex. A graph
+// without such a tour gives an empty vertex list and the largest double as
+// the distance, like the ant colony.
+class TspExactAlgorithms {
+ public:
+  using TsmResult = s21::TsmResult;
+
+  // A tour together with a proven lower bound on the length of any tour.
+  // gap is (distance - lower_bound) / |distance|, 0 once the tour is proven
+  // optimal. When no tour was found the distance is the largest double.
+  struct BoundedResult : TsmResult {
+    double lower_bound;
+    double gap;
+  };
+
+  // Largest order HeldKarp accepts; its table then takes about 0.8 GB.
+  static constexpr size_t kHeldKarpMaxOrder = 24;
+  static constexpr size_t kBranchAndBoundMaxOrder = 128;
+
+  // Bitmask dynamic programming over subsets of the vertices other than 0,
+  // O(2^n * n^2) time. Subsets of one size depend only on the previous size,
+  // so each size is filled on `threads` workers. Costs are stored as 32-bit
+  // integers when no tour can overflow them. The tour starts at vertex 0.
+  static TsmResult HeldKarp(const Matrix<int>& adjacency_matrix,
+                            size_t threads = 0);
+
+  // Depth-first branch and bound over tours grown from vertex 0. A partial
+  // tour is bounded by a 1-tree with the path contracted: a minimum spanning
+  // tree of the unvisited vertices plus the cheapest edges joining it to both
+  // ends of the path, under Held-Karp penalties found by subgradient
+  // optimisation at the root. Directed graphs are bounded through the lighter
+  // direction of every edge and, since that alone is weak, also by the
+  // assignment problem over the unvisited vertices; the larger bound is
+  // used. `initial_tour`, if valid, is the first upper bound. Workers keep
+  // their own node deques and steal the oldest nodes of others when they run
+  // out. With a non-zero `time_limit` the search stops after it and reports
+  // the best tour found so far; so it does once `cancel` reads true.
+  static BoundedResult BranchAndBound(
+      const Matrix<int>& adjacency_matrix,
+      const std::vector<int>& initial_tour = {},
+      std::chrono::milliseconds time_limit = std::chrono::milliseconds(0),
+      size_t threads = 0, const std::atomic<bool>* cancel = nullptr);
+
+ private:
+  template <typename Cost>
+  static TsmResult HeldKarpTable(const Matrix<int>& adjacency_matrix,
+                                 ThreadPool& pool);
+};
+
+}  // namespace s21
+
+#endif
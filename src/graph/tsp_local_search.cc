@@ -0,0 +1,296 @@
+#include "tsp_local_search.h"
+
+#include <algorithm>
+
+namespace s21 {
+
+TspLocalSearch::TspLocalSearch(const Matrix<int>& adjacency_matrix,
+                               const CandidateLists& candidates)
+    : weights_(adjacency_matrix.data()),
+      order_(adjacency_matrix.rows()),
+      candidates_(candidates),
+      position_(order_),
+      queued_(order_) {
+  for (size_t i = 0; i < order_ && symmetric_; i++) {
+    for (size_t j = i + 1; j < order_; j++) {
+      if (weights_[i * order_ + j] != weights_[j * order_ + i]) {
+        symmetric_ = false;
+        break;
+      }
+    }
+  }
+}
+
+double TspLocalSearch::Improve(std::vector<int>& tour, double length) {
+  while (true) {
+    double improved = OrOpt(tour, TwoOpt(tour, length));
+    if (improved >= length) {
+      return improved;
+    }
+    length = improved;
+  }
+}
+
+double TspLocalSearch::TwoOpt(std::vector<int>& tour, double length) {
+  if (!symmetric_ || tour.size() < 4) {
+    return length;
+  }
+  queue_.assign(tour.rbegin(), tour.rend());
+  return Descend(tour, length, false);
+}
+
+double TspLocalSearch::ThreeOpt(std::vector<int>& tour, double length) {
+  return ThreeOpt(tour, length, tour);
+}
+
+double TspLocalSearch::ThreeOpt(std::vector<int>& tour, double length,
+                                const std::vector<int>& active) {
+  if (tour.size() < kMaxSegment + 3) {
+    return length;
+  }
+  queue_.assign(active.rbegin(), active.rend());
+  return Descend(tour, length, true);
+}
+
+double TspLocalSearch::Descend(std::vector<int>& tour, double length,
+                               bool segment_moves) {
+  int front = tour.front();
+  IndexPositions(tour);
+
+  // Don't-look bits: only vertices next to a changed edge are revisited.
+  std::fill(queued_.begin(), queued_.end(), 0);
+  for (int vertex : queue_) {
+    queued_[vertex] = 1;
+  }
+  long long gain = 0;
+  while (!queue_.empty()) {
+    int a = queue_.back();
+    queue_.pop_back();
+    queued_[a] = 0;
+
+    Touched touched;
+    long long move_gain = symmetric_ ? TryTwoOpt(tour, a, touched) : 0;
+    if (move_gain == 0 && segment_moves) {
+      move_gain = TrySegmentMove(tour, a, touched);
+    }
+    if (move_gain == 0) {
+      continue;
+    }
+    gain += move_gain;
+    for (int vertex : touched) {
+      if (!queued_[vertex]) {
+        queued_[vertex] = 1;
+        queue_.push_back(vertex);
+      }
+    }
+  }
+
+  RestoreFront(tour, front);
+  return length - gain;
+}
+
+long long TspLocalSearch::TryTwoOpt(std::vector<int>& tour, int a,
+                                    Touched& touched) {
+  // Replaces (a, next a) and (c, next c) with (a, c) and (next a, next c).
+  int b = Next(tour, a);
+  int ab = Weight(a, b);
+  for (int c : candidates_.neighbors(a)) {
+    int ac = Weight(a, c);
+    if (ac >= ab) break;
+    int d = Next(tour, c);
+    if (c == b || d == a || !Weight(b, d)) continue;
+    long long gain = static_cast<long long>(ab) + Weight(c, d) - ac -
+                     Weight(b, d);
+    if (gain > 0) {
+      Reverse(tour, position_[b], position_[c]);
+      touched = {a, b, c, d, a, b};
+      return gain;
+    }
+  }
+
+  // The same with the previous vertices.
+  b = Previous(tour, a);
+  ab = Weight(b, a);
+  for (int c : candidates_.neighbors(a)) {
+    int ac = Weight(a, c);
+    if (ac >= ab) break;
+    int d = Previous(tour, c);
+    if (c == b || d == a || !Weight(b, d)) continue;
+    long long gain = static_cast<long long>(ab) + Weight(d, c) - ac -
+                     Weight(b, d);
+    if (gain > 0) {
+      Reverse(tour, position_[a], position_[d]);
+      touched = {a, b, c, d, a, b};
+      return gain;
+    }
+  }
+  return 0;
+}
+
+long long TspLocalSearch::TrySegmentMove(std::vector<int>& tour, int t1,
+                                         Touched& touched) {
+  // Removes (t1, t2), (t3, t4) and (t5, t6) and adds (t1, t4), (t5, t2) and
+  // (t3, t6): the segment t2 ... t3 moves between t5 and t6.
+  size_t n = tour.size();
+  int t2 = Next(tour, t1);
+  int d12 = Weight(t1, t2);
+  for (int t4 : candidates_.neighbors(t1)) {
+    int d14 = Weight(t1, t4);
+    if (d14 >= d12) break;
+    if (t4 == t2) continue;
+    int t3 = Previous(tour, t4);
+    long long opened = static_cast<long long>(d12) + Weight(t3, t4) - d14;
+    size_t segment = (position_[t3] + n - position_[t2]) % n + 1;
+    for (int t6 : candidates_.neighbors(t3)) {
+      int d36 = Weight(t3, t6);
+      if (d36 >= opened) break;
+      if (t6 == t4 || (position_[t6] + n - position_[t2]) % n < segment) {
+        continue;
+      }
+      int t5 = Previous(tour, t6);
+      if (!Weight(t5, t2)) continue;
+      long long gain = opened + Weight(t5, t6) - d36 - Weight(t5, t2);
+      if (gain <= 0) continue;
+
+      // The tour is S = t2..t3, B = t4..t5, C = t6..t1 and becomes B S C,
+      // which is also S C B and C B S: swap the two shortest neighbours.
+      size_t s = segment;
+      size_t b = (position_[t5] + n - position_[t4]) % n + 1;
+      size_t c = n - s - b;
+      if (c >= s && c >= b) {
+        SwapBlocks(tour, position_[t2], s, s + b);
+      } else if (s >= b) {
+        SwapBlocks(tour, position_[t4], b, b + c);
+      } else {
+        SwapBlocks(tour, position_[t6], c, c + s);
+      }
+      touched = {t1, t2, t3, t4, t5, t6};
+      return gain;
+    }
+  }
+  return 0;
+}
+
+void TspLocalSearch::SwapBlocks(std::vector<int>& tour, size_t from,
+                                size_t first, size_t count) {
+  size_t n = tour.size();
+  scratch_.resize(count);
+  for (size_t k = 0; k < count; k++) {
+    scratch_[k] = tour[(from + k) % n];
+  }
+  std::rotate(scratch_.begin(), scratch_.begin() + first, scratch_.end());
+  for (size_t k = 0; k < count; k++) {
+    size_t i = (from + k) % n;
+    tour[i] = scratch_[k];
+    position_[tour[i]] = i;
+  }
+}
+
+void TspLocalSearch::Reverse(std::vector<int>& tour, size_t from, size_t to) {
+  size_t n = tour.size();
+  size_t length = (to + n - from) % n + 1;
+  if (2 * length > n) {
+    size_t rest_from = (to + 1) % n;
+    to = (from + n - 1) % n;
+    from = rest_from;
+    length = n - length;
+  }
+  for (size_t k = 0; k < length / 2; k++) {
+    size_t i = (from + k) % n;
+    size_t j = (to + n - k) % n;
+    std::swap(tour[i], tour[j]);
+    position_[tour[i]] = i;
+    position_[tour[j]] = j;
+  }
+}
+
+double TspLocalSearch::OrOpt(std::vector<int>& tour, double length) {
+  if (tour.size() < kMaxSegment + 3) {
+    return length;
+  }
+  int front = tour.front();
+  IndexPositions(tour);
+
+  long long gain = 0;
+  bool improved = true;
+  while (improved) {
+    improved = false;
+    for (size_t start = 0; start < tour.size(); start++) {
+      for (int segment = 1; segment <= kMaxSegment; segment++) {
+        long long move_gain = TryOrOpt(tour, start, segment);
+        if (move_gain > 0) {
+          gain += move_gain;
+          improved = true;
+        }
+      }
+    }
+  }
+
+  RestoreFront(tour, front);
+  return length - gain;
+}
+
+long long TspLocalSearch::TryOrOpt(std::vector<int>& tour, size_t start,
+                                   int length) {
+  size_t n = tour.size();
+  int first = tour[start];
+  int last = tour[(start + length - 1) % n];
+  int before = Previous(tour, first);
+  int after = Next(tour, last);
+  if (!Weight(before, after)) {
+    return 0;
+  }
+  long long removed = static_cast<long long>(Weight(before, first)) +
+                      Weight(last, after) - Weight(before, after);
+  auto inside = [&](int vertex) {
+    return (position_[vertex] + n - start) % n < static_cast<size_t>(length);
+  };
+
+  // Inserts the segment between c and e = next c, as c -> first ... last -> e
+  // or, reversed, as c -> last ... first -> e.
+  for (int reversed = 0; reversed <= static_cast<int>(symmetric_);
+       reversed++) {
+    int head = reversed ? last : first;
+    int tail = reversed ? first : last;
+    for (int e : candidates_.neighbors(tail)) {
+      int c = Previous(tour, e);
+      if (inside(e) || inside(c) || !Weight(c, head)) continue;
+      long long added = static_cast<long long>(Weight(c, head)) +
+                        Weight(tail, e) - Weight(c, e);
+      if (added < removed) {
+        MoveSegment(tour, start, length, c, reversed);
+        return removed - added;
+      }
+    }
+  }
+  return 0;
+}
+
+void TspLocalSearch::MoveSegment(std::vector<int>& tour, size_t start,
+                                 int length, int after, bool reversed) {
+  size_t n = tour.size();
+  scratch_.clear();
+  for (size_t k = length; k < n; k++) {
+    int vertex = tour[(start + k) % n];
+    scratch_.push_back(vertex);
+    if (vertex != after) continue;
+    for (int j = 0; j < length; j++) {
+      int offset = reversed ? length - 1 - j : j;
+      scratch_.push_back(tour[(start + offset) % n]);
+    }
+  }
+  tour.swap(scratch_);
+  IndexPositions(tour);
+}
+
+void TspLocalSearch::IndexPositions(const std::vector<int>& tour) {
+  for (size_t i = 0; i < tour.size(); i++) {
+    position_[tour[i]] = i;
+  }
+}
+
+void TspLocalSearch::RestoreFront(std::vector<int>& tour, int front) {
+  std::rotate(tour.begin(), tour.begin() + position_[front], tour.end());
+}
+
+}  // namespace s21
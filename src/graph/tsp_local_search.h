@@ -0,0 +1,82 @@
+#ifndef _TSP_LOCAL_SEARCH_H_
+#define _TSP_LOCAL_SEARCH_H_
+
+#include <array>
+#include <vector>
+
+#include "candidate_lists.h"
+#include "t_matrix.h"
+
+namespace s21 {
+
+// Improves closed tours given as vertex sequences. Moves only introduce edges
+// present in the adjacency matrix. 2-opt reverses part of the tour and runs
+// on symmetric graphs only; Or-opt moves segments of up to three vertices and
+// reverses them only on symmetric graphs. ThreeOpt adds the sequential 3-opt
+// move that moves a segment of any length elsewhere without reversing it, so
+// it also works on directed graphs. All moves look for new edges among the
+// candidate lists of the endpoints. The first vertex of the tour is kept.
+class TspLocalSearch {
+ public:
+  TspLocalSearch(const Matrix<int>& adjacency_matrix,
+                 const CandidateLists& candidates);
+
+  // Alternates 2-opt and Or-opt until neither improves `tour`; returns its
+  // new length.
+  double Improve(std::vector<int>& tour, double length);
+  double TwoOpt(std::vector<int>& tour, double length);
+  double OrOpt(std::vector<int>& tour, double length);
+  // 2-opt (on symmetric graphs) and segment moves with don't-look bits,
+  // starting from every vertex or only from `active` ones.
+  double ThreeOpt(std::vector<int>& tour, double length);
+  double ThreeOpt(std::vector<int>& tour, double length,
+                  const std::vector<int>& active);
+
+  bool symmetric() const { return symmetric_; }
+
+ private:
+  static constexpr int kMaxSegment = 3;
+
+  int Weight(int from, int to) const { return weights_[from * order_ + to]; }
+  int Next(const std::vector<int>& tour, int vertex) const {
+    return tour[(position_[vertex] + 1) % tour.size()];
+  }
+  int Previous(const std::vector<int>& tour, int vertex) const {
+    return tour[(position_[vertex] + tour.size() - 1) % tour.size()];
+  }
+
+  using Touched = std::array<int, 6>;
+
+  // Runs improving moves from the queued vertices until none is left,
+  // re-queueing the endpoints of every changed edge.
+  double Descend(std::vector<int>& tour, double length, bool segment_moves);
+  // Try an improving move starting at `a`; on success return the gain and
+  // store the endpoints of the changed edges in `touched`.
+  long long TryTwoOpt(std::vector<int>& tour, int a, Touched& touched);
+  long long TrySegmentMove(std::vector<int>& tour, int a, Touched& touched);
+  // Turns the blocks [from, from + first) and [from + first, from + count)
+  // of cyclic positions into their swapped order.
+  void SwapBlocks(std::vector<int>& tour, size_t from, size_t first,
+                  size_t count);
+  // Reverses the cyclic range of positions [from, to], or the rest of the
+  // tour when that is shorter.
+  void Reverse(std::vector<int>& tour, size_t from, size_t to);
+  long long TryOrOpt(std::vector<int>& tour, size_t start, int length);
+  void MoveSegment(std::vector<int>& tour, size_t start, int length,
+                   int after, bool reversed);
+  void IndexPositions(const std::vector<int>& tour);
+  void RestoreFront(std::vector<int>& tour, int front);
+
+  const int* weights_;
+  size_t order_;
+  const CandidateLists& candidates_;
+  bool symmetric_ = true;
+  std::vector<size_t> position_;
+  std::vector<char> queued_;
+  std::vector<int> queue_;
+  std::vector<int> scratch_;
+};
+
+}  // namespace s21
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef _TSP_SEARCH_CONTROL_H_
+#define _TSP_SEARCH_CONTROL_H_
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <limits>
+#include <vector>
+
+namespace s21 {
+
+// A closed tour and its length, the result of every TSP solver. A solver
+// that finds no tour returns an empty vertex list and the largest double.
+struct TsmResult {
+  std::vector<int> vertices;
+  double distance;
+};
+
+// Stopping rules and progress reporting for the iterative TSP engines. The
+// rules are checked between iterations; an engine that stops early returns
+// the best tour found so far.
+struct TspSearchControl {
+  // Wall-clock budget of the whole solve; zero means no limit.
+  std::chrono::milliseconds time_budget{0};
+  // Stop after this many iterations without a shorter tour; 0 - never.
+  size_t stagnation_limit = 0;
+  // Called with the best tour each time it improves. The tour may start at
+  // any vertex.
+  std::function<void(const std::vector<int>& tour, double distance)>
+      on_improvement;
+  // The search stops once this flag reads true.
+  const std::atomic<bool>* cancel = nullptr;
+};
+
+// Applies a TspSearchControl to one run.
+class TspSearchMonitor {
+ public:
+  explicit TspSearchMonitor(const TspSearchControl& control)
+      : control_(control), start_(std::chrono::steady_clock::now()) {}
+
+  // Takes the best tour after an iteration, reports it if it improved and
+  // returns true when the search should stop.
+  bool Update(const std::vector<int>& tour, double distance) {
+    if (!tour.empty() && distance < best_) {
+      best_ = distance;
+      stalled_ = 0;
+      if (control_.on_improvement) {
+        control_.on_improvement(tour, distance);
+      }
+    } else {
+      stalled_++;
+    }
+    return Interrupted() || (control_.stagnation_limit > 0 &&
+                             stalled_ >= control_.stagnation_limit);
+  }
+
+  // True once the run is cancelled or out of time.
+  bool Interrupted() const {
+    if (control_.cancel && control_.cancel->load()) {
+      return true;
+    }
+    return control_.time_budget.count() > 0 &&
+           std::chrono::steady_clock::now() - start_ >= control_.time_budget;
+  }
+
+ private:
+  const TspSearchControl& control_;
+  std::chrono::steady_clock::time_point start_;
+  double best_ = std::numeric_limits<double>::max();
+  size_t stalled_ = 0;
+};
+
+}  // namespace s21
+
+#endif
@@ -107,7 +107,16 @@ TEST(MST, tm3) {
 TEST(MST, tm3_1) {
   s21::Graph g;
   g.LoadGraphFromFile("./tests/test_matrices/tm4.txt");
-  EXPECT_ANY_THROW(s21::GraphAlgorithms::TsmResult res = s21::GraphAlgorithms::SolveTravelingSalesmanProblem(g));
+  s21::GraphAlgorithms::TsmResult res =
+      s21::GraphAlgorithms::SolveTravelingSalesmanProblem(g);
+  EXPECT_EQ(res.distance, 18);
+}
+
+TEST(MST, tm9) {
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm9.txt");
+  EXPECT_ANY_THROW(s21::GraphAlgorithms::TsmResult res =
+                       s21::GraphAlgorithms::SolveTravelingSalesmanProblem(g));
 }
 
 TEST(MST, tm5) {
@@ -134,3 +143,875 @@ TEST(MST, tm8) {
   s21::GraphAlgorithms::TsmResult res = s21::GraphAlgorithms::SolveTravelingSalesmanProblem(g);
   EXPECT_EQ(res.distance, 58);
 }
+
+TEST(Floyd, ParallelBlockedMatchesBellmanFord) {
+  s21::Graph g = RandomGraph(150, 0.05, 20, 26);
+  s21::Matrix<int> m =
+      s21::GraphAlgorithms::GetShortestPathsBetweenAllVertices(g, 3);
+  for (int source = 0; source < 150; source += 7) {
+    std::vector<int> row =
+        s21::GraphAlgorithms::FordBellmanAlgorithm(g, source);
+    for (size_t j = 0; j < row.size(); j++) {
+      EXPECT_EQ(m(source, j), row[j]);
+    }
+  }
+}
+
+TEST(Floyd, ParallelBlockedUnevenTiles) {
+  s21::Graph g = RandomGraph(70, 0.1, 9, 7);
+  s21::Matrix<int> serial =
+      s21::ShortestPathAlgorithms::ParallelFloydWarshall(g.adjacency_matrix(),
+                                                         1, 70);
+  s21::Matrix<int> blocked =
+      s21::ShortestPathAlgorithms::ParallelFloydWarshall(g.adjacency_matrix(),
+                                                         4, 16);
+  std::vector<int> exp(serial.data(), serial.data() + 70 * 70);
+  EXPECT_TRUE(blocked.EqVector(exp));
+}
+
+TEST(Johnson, tm2NegativeEdges) {
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm2.txt");
+  s21::Matrix<int> m = s21::GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+      g, 2, s21::GraphAlgorithms::ApspEngine::kJohnson);
+  std::vector<int> exp{0, 5, 3, 8, -5, 0, -2, 3, -3, 2, 0, 5, -8, -3, -5, 0};
+  EXPECT_EQ(m.EqVector(exp), true);
+}
+
+TEST(Johnson, MatchesFloydOnSparseGraph) {
+  const size_t order = 120;
+  s21::Graph base = RandomGraph(order, 0.03, 10, 27);
+  std::mt19937 gen(27);
+  std::uniform_int_distribution<> shift(0, 6);
+  std::vector<int> p(order);
+  for (int& x : p) x = shift(gen);
+  s21::Matrix<int> m = base.adjacency_matrix();
+  for (size_t i = 0; i < order; i++) {
+    for (size_t j = 0; j < order; j++) {
+      if (m(i, j) != 0) m(i, j) += p[i] - p[j];
+    }
+  }
+  s21::Graph g(std::move(m));
+  s21::Matrix<int> floyd =
+      s21::GraphAlgorithms::GetShortestPathsBetweenAllVertices(
+          g, 2, s21::GraphAlgorithms::ApspEngine::kFloyd);
+  s21::Matrix<int> johnson =
+      s21::GraphAlgorithms::GetShortestPathsBetweenAllVertices(g, 2);
+  std::vector<int> exp(floyd.data(), floyd.data() + order * order);
+  EXPECT_TRUE(johnson.EqVector(exp));
+}
+
+TEST(Johnson, NegativeCycleThrows) {
+  s21::Matrix<int> m(3, 3);
+  m(0, 1) = 1;
+  m(1, 2) = -3;
+  m(2, 0) = 1;
+  EXPECT_THROW(s21::ShortestPathAlgorithms::Johnson(m), std::runtime_error);
+}
+
+TEST(StreamAllPairs, RowsMatchFloyd) {
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm1.txt");
+  s21::Matrix<int> floyd =
+      s21::GraphAlgorithms::GetShortestPathsBetweenAllVertices(g);
+  size_t rows = 0;
+  s21::GraphAlgorithms::StreamShortestPathsBetweenAllVertices(
+      g, [&](int source, const int* row) {
+        rows++;
+        for (size_t j = 0; j < g.order(); j++) {
+          EXPECT_EQ(row[j], floyd(source, j));
+        }
+      });
+  EXPECT_EQ(rows, g.order());
+}
+
+TEST(StreamAllPairs, ExportEncodingsRoundTrip) {
+  s21::Graph g = RandomGraph(40, 0.1, 3000, 28);
+  s21::Matrix<int> floyd =
+      s21::GraphAlgorithms::GetShortestPathsBetweenAllVertices(g);
+  for (s21::DistanceEncoding encoding :
+       {s21::DistanceEncoding::kInt32, s21::DistanceEncoding::kUInt16Saturated,
+        s21::DistanceEncoding::kDelta}) {
+    std::string file = "./tests/dot_outputs/dist_table.bin";
+    s21::GraphAlgorithms::ExportShortestPathsBetweenAllVertices(g, file,
+                                                                encoding, 2);
+    s21::DistanceTableReader reader(file);
+    EXPECT_EQ(reader.order(), 40);
+    for (int i = 0; i < 40; i++) {
+      std::vector<int> row = reader.ReadRow(i);
+      for (size_t j = 0; j < 40; j++) {
+        int exp = floyd(i, j);
+        if (encoding == s21::DistanceEncoding::kUInt16Saturated &&
+            exp >= 65535) {
+          exp = std::numeric_limits<int>::max();
+        }
+        EXPECT_EQ(row[j], exp);
+      }
+    }
+  }
+}
+
+TEST(StreamAllPairs, MalformedDeltaRowThrows) {
+  std::string file = "./tests/dot_outputs/dist_table.bin";
+  {
+    s21::DistanceTableWriter writer(file, 2, s21::DistanceEncoding::kDelta);
+    int row[2] = {std::numeric_limits<int>::max(), 0};
+    writer.WriteRow(0, row);
+    writer.WriteRow(1, row);
+  }
+  // The first row is two five-byte varints right after the header and the
+  // row index; continuation bits on all ten bytes overrun 64 bits.
+  {
+    std::fstream stream(file, std::ios::in | std::ios::out | std::ios::binary);
+    stream.seekp(64);
+    std::string continued(10, static_cast<char>(0x80));
+    stream.write(continued.data(), continued.size());
+  }
+  s21::DistanceTableReader reader(file);
+  EXPECT_THROW(reader.ReadRow(0), std::runtime_error);
+  EXPECT_EQ(reader.ReadRow(1)[0], std::numeric_limits<int>::max());
+}
+
+TEST(DistanceTable, MatchesFloydRows) {
+  s21::Graph g = RandomGraph(90, 0.03, 15, 29);
+  s21::Matrix<int> floyd =
+      s21::GraphAlgorithms::GetShortestPathsBetweenAllVertices(g);
+  std::vector<int> origins{5, 0, 89, 5};
+  std::vector<int> targets{1, 44, 44, 0, 17, 88};
+  s21::Matrix<int> table =
+      s21::GraphAlgorithms::GetDistanceTable(g, origins, targets, 2);
+  ASSERT_EQ(table.rows(), origins.size());
+  ASSERT_EQ(table.cols(), targets.size());
+  for (size_t i = 0; i < origins.size(); i++) {
+    for (size_t j = 0; j < targets.size(); j++) {
+      EXPECT_EQ(table(i, j), floyd(origins[i], targets[j]));
+    }
+  }
+}
+
+TEST(DistanceTable, InvalidVertex) {
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm2.txt");
+  EXPECT_THROW(s21::GraphAlgorithms::GetDistanceTable(g, {0}, {4}),
+               std::runtime_error);
+}
+
+TEST(BoundedWeights, DialAndRadixHeapMatchBellmanFord) {
+  for (int max_weight : {9, 100000}) {
+    s21::Graph g = RandomGraph(80, 0.06, max_weight, 30);
+    s21::AdjacencyList list(g.adjacency_matrix());
+    for (int source : {0, 13, 79}) {
+      std::vector<int> exp =
+          s21::GraphAlgorithms::FordBellmanAlgorithm(g, source);
+      EXPECT_EQ(s21::ShortestPathAlgorithms::Dial(list, source, max_weight),
+                exp);
+      EXPECT_EQ(s21::ShortestPathAlgorithms::RadixHeapDijkstra(list, source),
+                exp);
+      EXPECT_EQ(s21::GraphAlgorithms::GetShortestPathsFromVertex(g, source),
+                exp);
+    }
+  }
+}
+
+TEST(BoundedWeights, NoPathThrows) {
+  s21::Matrix<int> m(3, 3);
+  m(0, 1) = 4;
+  s21::Graph g(std::move(m));
+  EXPECT_EQ(s21::GraphAlgorithms::GetShortestPathBetweenVertices(g, 0, 1), 4);
+  EXPECT_THROW(s21::GraphAlgorithms::GetShortestPathBetweenVertices(g, 0, 2),
+               std::runtime_error);
+}
+
+TEST(PathCache, RepeatedQueriesHit) {
+  s21::GraphAlgorithms::path_cache().Clear();
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm5.txt");
+  EXPECT_EQ(s21::GraphAlgorithms::GetShortestPathBetweenVertices(g, 3, 0), 16);
+  EXPECT_EQ(s21::GraphAlgorithms::GetShortestPathBetweenVertices(g, 3, 0), 16);
+  std::vector<int> row = s21::GraphAlgorithms::GetShortestPathsFromVertex(g, 3);
+  EXPECT_EQ(row[0], 16);
+  s21::ShortestPathCache::Stats stats =
+      s21::GraphAlgorithms::path_cache().stats();
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.hits, 2);
+
+  g.LoadGraphFromFile("./tests/test_matrices/tm5.txt");
+  s21::GraphAlgorithms::GetShortestPathBetweenVertices(g, 3, 0);
+  EXPECT_EQ(s21::GraphAlgorithms::path_cache().stats().misses, 2);
+}
+
+TEST(PathCache, EvictsLeastRecentlyUsed) {
+  s21::ShortestPathTree tree{0, std::vector<int>(100), std::vector<int>(100)};
+  size_t bytes = s21::ShortestPathCache::TreeBytes(tree);
+  s21::ShortestPathCache cache(2 * bytes);
+  auto alg = s21::ShortestPathCache::Algorithm::kDial;
+  cache.GetOrCompute({1, alg, 0}, [&] { return tree; });
+  cache.GetOrCompute({1, alg, 1}, [&] { return tree; });
+  EXPECT_NE(cache.Find({1, alg, 0}), nullptr);
+  cache.GetOrCompute({1, alg, 2}, [&] { return tree; });
+  EXPECT_EQ(cache.Find({1, alg, 1}), nullptr);
+  EXPECT_NE(cache.Find({1, alg, 0}), nullptr);
+  EXPECT_EQ(cache.stats().evictions, 1);
+  EXPECT_EQ(cache.stats().bytes, 2 * bytes);
+}
+
+TEST(MST, PrimHeapMatchesDense) {
+  s21::Graph g = RandomGraph(120, 0.08, 6, 32, true);
+  std::vector<int> dense =
+      s21::SpanningTreeAlgorithms::PrimDense(g.adjacency_matrix());
+  std::vector<int> heap = s21::SpanningTreeAlgorithms::PrimHeap(
+      s21::AdjacencyList(g.adjacency_matrix()));
+  EXPECT_EQ(dense, heap);
+  EXPECT_EQ(dense[0], -1);
+}
+
+TEST(MST, BoruvkaMatchesPrimWeight) {
+  s21::Graph g = RandomGraph(150, 0.1, 20, 33, true);
+  s21::Matrix<int> prim = s21::GraphAlgorithms::GetLeastSpanningTree(g);
+  long long prim_weight = 0;
+  for (size_t i = 0; i < g.order(); i++) {
+    for (size_t j = i + 1; j < g.order(); j++) prim_weight += prim(i, j);
+  }
+  s21::SpanningTree forest =
+      s21::GraphAlgorithms::GetMinimumSpanningForest(g, 3);
+  EXPECT_EQ(forest.edges.size(), g.order() - 1);
+  EXPECT_EQ(forest.weight(), prim_weight);
+}
+
+TEST(MST, BoruvkaDisconnectedForest) {
+  s21::Matrix<int> m(6, 6);
+  m(0, 1) = m(1, 0) = 3;
+  m(1, 2) = m(2, 1) = 1;
+  m(0, 2) = m(2, 0) = 2;
+  m(3, 4) = m(4, 3) = 5;
+  s21::Graph g(std::move(m));
+  std::vector<s21::WeightedEdge> forest =
+      s21::GraphAlgorithms::GetMinimumSpanningForest(g, 2).edges;
+  ASSERT_EQ(forest.size(), 3);
+  EXPECT_EQ(forest[0].weight, 1);
+  EXPECT_EQ(forest[1].weight, 2);
+  EXPECT_EQ(forest[2].from, 3);
+  EXPECT_EQ(forest[2].to, 4);
+}
+
+TEST(MST, FilterKruskalMatchesBoruvka) {
+  s21::Graph g = RandomGraph(200, 0.05, 3, 34, true);
+  std::vector<s21::WeightedEdge> boruvka =
+      s21::SpanningTreeAlgorithms::Boruvka(g.adjacency_matrix(), 2);
+  std::vector<s21::WeightedEdge> kruskal =
+      s21::SpanningTreeAlgorithms::FilterKruskal(
+          s21::SpanningTreeAlgorithms::UndirectedEdges(g.adjacency_matrix()),
+          g.order(), 2, 16);
+  ASSERT_EQ(kruskal.size(), boruvka.size());
+  for (size_t i = 0; i < kruskal.size(); i++) {
+    EXPECT_EQ(kruskal[i].from, boruvka[i].from);
+    EXPECT_EQ(kruskal[i].to, boruvka[i].to);
+    EXPECT_EQ(kruskal[i].weight, boruvka[i].weight);
+  }
+}
+
+TEST(MST, FilterKruskalDuplicateEdges) {
+  std::vector<s21::WeightedEdge> copies(20000, {0, 1, 5});
+  std::vector<s21::WeightedEdge> forest =
+      s21::SpanningTreeAlgorithms::FilterKruskal(copies, 2, 1, 16);
+  ASSERT_EQ(forest.size(), 1);
+  EXPECT_EQ(forest[0].weight, 5);
+
+  s21::Graph g = RandomGraph(100, 0.1, 3, 35, true);
+  std::vector<s21::WeightedEdge> edges =
+      s21::SpanningTreeAlgorithms::UndirectedEdges(g.adjacency_matrix());
+  std::vector<s21::WeightedEdge> multigraph;
+  for (int copy = 0; copy < 3; copy++) {
+    multigraph.insert(multigraph.end(), edges.begin(), edges.end());
+  }
+  std::vector<s21::WeightedEdge> expected =
+      s21::SpanningTreeAlgorithms::FilterKruskal(edges, g.order(), 1, 16);
+  forest =
+      s21::SpanningTreeAlgorithms::FilterKruskal(multigraph, g.order(), 2, 16);
+  ASSERT_EQ(forest.size(), expected.size());
+  for (size_t i = 0; i < forest.size(); i++) {
+    EXPECT_EQ(forest[i].from, expected[i].from);
+    EXPECT_EQ(forest[i].to, expected[i].to);
+    EXPECT_EQ(forest[i].weight, expected[i].weight);
+  }
+}
+
+TEST(MST, ParallelSort) {
+  std::vector<int> values(50000);
+  std::mt19937 gen(34);
+  for (int& v : values) v = gen() % 1000;
+  std::vector<int> exp = values;
+  std::sort(exp.begin(), exp.end());
+  s21::ThreadPool pool(4);
+  pool.Sort(values.begin(), values.end(), std::less<int>());
+  EXPECT_EQ(values, exp);
+}
+
+TEST(Trees, SpanningTreeEdgesToMatrix) {
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm1.txt");
+  s21::SpanningTree tree = s21::GraphAlgorithms::GetLeastSpanningTreeEdges(g);
+  EXPECT_EQ(tree.edges.size(), 4);
+  EXPECT_EQ(tree.weight(), 10);
+  std::vector<int> exp{0, 2, 0, 0, 0, 2, 0, 3, 0, 0, 0, 3, 0,
+                       0, 4, 0, 0, 0, 0, 1, 0, 0, 4, 1, 0};
+  EXPECT_TRUE(tree.ToMatrix().EqVector(exp));
+}
+
+TEST(Trees, ShortestPathTreeRoutes) {
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm5.txt");
+  s21::ShortestPathTree tree = s21::GraphAlgorithms::GetShortestPathTree(g, 3);
+  std::vector<int> path = tree.PathTo(0);
+  ASSERT_FALSE(path.empty());
+  EXPECT_EQ(path.front(), 3);
+  EXPECT_EQ(path.back(), 0);
+  int length = 0;
+  for (size_t i = 0; i + 1 < path.size(); i++) {
+    length += g.adjacency_matrix()(path[i], path[i + 1]);
+  }
+  EXPECT_EQ(length, 16);
+
+  g.LoadGraphFromFile("./tests/test_matrices/tm2.txt");
+  tree = s21::GraphAlgorithms::GetShortestPathTree(g, 0);
+  EXPECT_EQ(tree.distance,
+            s21::GraphAlgorithms::FordBellmanAlgorithm(g, 0));
+  EXPECT_EQ(tree.PathTo(2), (std::vector<int>{0, 1, 3, 2}));
+  EXPECT_EQ(tree.ToMatrix()(3, 2), -5);
+}
+
+TEST(AntColony, AntBuildsHamiltonianCycle) {
+  s21::Graph g = RandomGraph(40, 1.0, 50, 36, true);
+  s21::Matrix<double> pheromones(40, 40, 1.0);
+  s21::AntColonyAlgorithms::Ant ant;
+  for (int start : {0, 17, 39}) {
+    ant.Reset(start, 40);
+    ant.Launch(g.adjacency_matrix(), pheromones);
+    ASSERT_EQ(ant.path.size(), 40);
+    EXPECT_EQ(ant.path.front(), start);
+    double length = g.adjacency_matrix()(ant.path.back(), ant.path.front());
+    for (size_t i = 0; i + 1 < ant.path.size(); i++) {
+      length += g.adjacency_matrix()(ant.path[i], ant.path[i + 1]);
+    }
+    EXPECT_EQ(ant.distance, length);
+    std::vector<int> vertices = ant.path;
+    std::sort(vertices.begin(), vertices.end());
+    for (int v = 0; v < 40; v++) EXPECT_EQ(vertices[v], v);
+  }
+}
+
+TEST(AntColony, FixedSeedIsReproducible) {
+  s21::Graph g = RandomGraph(30, 1.0, 100, 37, true);
+  s21::AntColonyAlgorithms::TsmResult a =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(g, 5, 1, 42);
+  s21::AntColonyAlgorithms::TsmResult b =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(g, 5, 1, 42);
+  EXPECT_EQ(a.vertices, b.vertices);
+  EXPECT_EQ(a.distance, b.distance);
+}
+
+TEST(AntColony, ThreadCountDoesNotChangeResult) {
+  s21::Graph g = RandomGraph(60, 0.6, 100, 38, true);
+  s21::AntColonyAlgorithms::TsmResult serial =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(g, 5, 2, 9, 1);
+  for (size_t threads : {2, 4}) {
+    s21::AntColonyAlgorithms::TsmResult parallel =
+        s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(g, 5, 2, 9,
+                                                                threads);
+    EXPECT_EQ(parallel.vertices, serial.vertices);
+    EXPECT_EQ(parallel.distance, serial.distance);
+  }
+}
+
+TEST(AntColony, PrefersShortEdges) {
+  constexpr int n = 40;
+  s21::Matrix<int> adj(n, n, 100);
+  for (int i = 0; i < n; i++) {
+    adj(i, i) = 0;
+    adj(i, (i + 1) % n) = 1;
+    adj((i + 1) % n, i) = 1;
+  }
+  s21::Graph g(std::move(adj));
+  s21::AntColonyParameters parameters;
+  parameters.initial_tour = false;
+  s21::AntColonyAlgorithms::TsmResult result =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(g, 10, 1, 3, 0,
+                                                              parameters);
+  EXPECT_EQ(result.distance, n);
+}
+
+TEST(AntColony, CandidateListsAreNearestFirst) {
+  s21::Matrix<int> adj(4, 4, 0);
+  adj(0, 1) = 5;
+  adj(0, 2) = 3;
+  adj(0, 3) = 3;
+  adj(1, 0) = 1;
+  s21::CandidateLists lists(adj, 2);
+  EXPECT_EQ(std::vector<int>(lists.neighbors(0).begin(),
+                             lists.neighbors(0).end()),
+            (std::vector<int>{2, 3}));
+  EXPECT_EQ(lists.neighbors(1).size(), 1);
+  EXPECT_EQ(lists.neighbors(2).size(), 0);
+}
+
+TEST(AntColony, CandidateListsFallBackToAllVertices) {
+  s21::Graph g = RandomGraph(80, 1.0, 1000, 40, true);
+  s21::AntColonyParameters parameters;
+  parameters.candidates = 3;
+  parameters.initial_tour = false;
+  s21::AntColonyAlgorithms::TsmResult result =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(g, 3, 1, 5, 0,
+                                                              parameters);
+  ASSERT_EQ(result.vertices.size(), 80);
+  std::vector<int> sorted = result.vertices;
+  std::sort(sorted.begin(), sorted.end());
+  for (int v = 0; v < 80; v++) EXPECT_EQ(sorted[v], v);
+}
+
+// Length of a closed tour, or -1 if it uses a missing edge or is not a
+// permutation of the vertices.
+static double TourLength(const s21::Matrix<int>& adj,
+                         const std::vector<int>& tour) {
+  std::vector<int> sorted = tour;
+  std::sort(sorted.begin(), sorted.end());
+  for (size_t v = 0; v < sorted.size(); v++) {
+    if (sorted[v] != static_cast<int>(v)) return -1;
+  }
+  double length = 0;
+  for (size_t i = 0; i < tour.size(); i++) {
+    int weight = adj(tour[i], tour[(i + 1) % tour.size()]);
+    if (!weight) return -1;
+    length += weight;
+  }
+  return length;
+}
+
+TEST(LocalSearch, KeepsToursValid) {
+  for (bool symmetric : {true, false}) {
+    s21::Graph g = RandomGraph(120, 0.3, 100, 41, symmetric);
+    s21::Matrix<int> adj = g.adjacency_matrix();
+    std::vector<int> tour(120);
+    for (int v = 0; v < 120; v++) {
+      tour[v] = v;
+      adj(v, (v + 1) % 120) = 1000;
+      if (symmetric) adj((v + 1) % 120, v) = 1000;
+    }
+    s21::CandidateLists candidates(adj, 8);
+    s21::TspLocalSearch search(adj, candidates);
+    EXPECT_EQ(search.symmetric(), symmetric);
+    double before = TourLength(adj, tour);
+    double after = search.Improve(tour, before);
+    EXPECT_LT(after, before);
+    EXPECT_EQ(after, TourLength(adj, tour));
+    EXPECT_EQ(tour.front(), 0);
+  }
+}
+
+TEST(LocalSearch, TwoOptOnSymmetricGraph) {
+  s21::Graph g = RandomGraph(200, 1.0, 1000, 42, true);
+  s21::CandidateLists candidates(g.adjacency_matrix(), 10);
+  s21::TspLocalSearch search(g.adjacency_matrix(), candidates);
+  ASSERT_TRUE(search.symmetric());
+  std::vector<int> tour(200);
+  std::mt19937 gen(42);
+  for (int v = 0; v < 200; v++) tour[v] = v;
+  std::shuffle(tour.begin() + 1, tour.end(), gen);
+  double before = TourLength(g.adjacency_matrix(), tour);
+  double after = search.TwoOpt(tour, before);
+  EXPECT_LT(after, before / 2);
+  EXPECT_EQ(after, TourLength(g.adjacency_matrix(), tour));
+  double improved = search.Improve(tour, after);
+  EXPECT_LE(improved, after);
+  EXPECT_EQ(improved, TourLength(g.adjacency_matrix(), tour));
+}
+
+// Shortest tour by trying every order of the vertices after 0; -1 if none.
+static double BruteForceTour(const s21::Matrix<int>& adj) {
+  std::vector<int> tour(adj.rows());
+  for (size_t v = 0; v < tour.size(); v++) tour[v] = v;
+  double best = -1;
+  do {
+    double length = TourLength(adj, tour);
+    if (length != -1 && (best == -1 || length < best)) best = length;
+  } while (std::next_permutation(tour.begin() + 1, tour.end()));
+  return best;
+}
+
+TEST(HeldKarp, MatchesBruteForce) {
+  for (unsigned seed = 0; seed < 6; seed++) {
+    s21::Graph g = RandomGraph(8, 0.3 + 0.1 * seed, 50, 50 + seed, seed % 2);
+    double expected = BruteForceTour(g.adjacency_matrix());
+    s21::TspExactAlgorithms::TsmResult result =
+        s21::TspExactAlgorithms::HeldKarp(g.adjacency_matrix(), 2);
+    if (expected == -1) {
+      EXPECT_TRUE(result.vertices.empty());
+      continue;
+    }
+    EXPECT_EQ(result.distance, expected);
+    EXPECT_EQ(TourLength(g.adjacency_matrix(), result.vertices), expected);
+    EXPECT_EQ(result.vertices.front(), 0);
+  }
+}
+
+TEST(HeldKarp, WideCosts) {
+  s21::Matrix<int> adj(7, 7);
+  for (int i = 0; i < 7; i++) {
+    for (int j = 0; j < 7; j++) {
+      if (i != j) adj(i, j) = 1000000000 - (i * 7 + j * 3) % 100;
+    }
+  }
+  s21::TspExactAlgorithms::TsmResult result =
+      s21::TspExactAlgorithms::HeldKarp(adj);
+  EXPECT_EQ(result.distance, BruteForceTour(adj));
+  EXPECT_GT(result.distance, std::numeric_limits<int>::max());
+}
+
+TEST(HeldKarp, FacadePicksExactSolver) {
+  s21::Graph g = RandomGraph(14, 1.0, 100, 57, true);
+  s21::GraphAlgorithms::TsmResult exact =
+      s21::GraphAlgorithms::SolveTravelingSalesmanProblem(g, 1);
+  s21::GraphAlgorithms::TsmResult colony =
+      s21::GraphAlgorithms::SolveTravelingSalesmanProblem(
+          g, 1, 0, s21::GraphAlgorithms::TspEngine::kAntColony);
+  EXPECT_EQ(exact.distance,
+            s21::TspExactAlgorithms::HeldKarp(g.adjacency_matrix()).distance);
+  EXPECT_LE(exact.distance, colony.distance);
+  EXPECT_ANY_THROW(s21::TspExactAlgorithms::HeldKarp(
+      RandomGraph(25, 1.0, 10, 58).adjacency_matrix()));
+}
+
+TEST(BranchAndBound, MatchesHeldKarp) {
+  for (unsigned seed = 0; seed < 4; seed++) {
+    s21::Graph g = RandomGraph(13, seed < 2 ? 1.0 : 0.5, 100, 60 + seed,
+                               seed % 2 == 0);
+    s21::TspExactAlgorithms::TsmResult exact =
+        s21::TspExactAlgorithms::HeldKarp(g.adjacency_matrix());
+    s21::TspExactAlgorithms::BoundedResult result =
+        s21::TspExactAlgorithms::BranchAndBound(g.adjacency_matrix(), {},
+                                                std::chrono::milliseconds(0),
+                                                3);
+    EXPECT_EQ(result.distance, exact.distance);
+    EXPECT_EQ(result.lower_bound, result.distance);
+    EXPECT_EQ(result.gap, 0.0);
+    if (!exact.vertices.empty()) {
+      EXPECT_EQ(TourLength(g.adjacency_matrix(), result.vertices),
+                exact.distance);
+    } else {
+      EXPECT_TRUE(result.vertices.empty());
+    }
+  }
+}
+
+TEST(BranchAndBound, ProvesColonyTourOnSymmetricGraph) {
+  s21::Graph g = RandomGraph(40, 1.0, 1000, 64, true);
+  s21::GraphAlgorithms::TsmResult colony =
+      s21::GraphAlgorithms::SolveTravelingSalesmanProblem(
+          g, 2, 0, s21::GraphAlgorithms::TspEngine::kAntColony);
+  s21::TspExactAlgorithms::BoundedResult result =
+      s21::TspExactAlgorithms::BranchAndBound(g.adjacency_matrix(),
+                                              colony.vertices);
+  EXPECT_LE(result.distance, colony.distance);
+  EXPECT_EQ(result.gap, 0.0);
+  EXPECT_EQ(result.vertices.front(), 0);
+  EXPECT_EQ(TourLength(g.adjacency_matrix(), result.vertices),
+            result.distance);
+}
+
+TEST(BranchAndBound, ProvesDirectedTourBeyondHeldKarp) {
+  s21::Graph g = RandomGraph(30, 1.0, 100, 68);
+  s21::TspExactAlgorithms::BoundedResult result =
+      s21::TspExactAlgorithms::BranchAndBound(
+          g.adjacency_matrix(), {}, std::chrono::seconds(20), 2);
+  EXPECT_EQ(TourLength(g.adjacency_matrix(), result.vertices),
+            result.distance);
+  EXPECT_EQ(result.gap, 0.0);
+}
+
+TEST(BranchAndBound, TimeLimitReportsGap) {
+  s21::Graph g = RandomGraph(120, 1.0, 1000, 65, true);
+  std::vector<int> tour(120);
+  for (int v = 0; v < 120; v++) tour[v] = (v * 7) % 120;
+  double initial = TourLength(g.adjacency_matrix(), tour);
+  s21::TspExactAlgorithms::BoundedResult result =
+      s21::TspExactAlgorithms::BranchAndBound(
+          g.adjacency_matrix(), tour, std::chrono::milliseconds(50), 2);
+  EXPECT_LE(result.distance, initial);
+  EXPECT_EQ(TourLength(g.adjacency_matrix(), result.vertices),
+            result.distance);
+  EXPECT_LT(result.lower_bound, result.distance);
+  EXPECT_GT(result.gap, 0.0);
+  EXPECT_LT(result.gap, 1.0);
+}
+
+TEST(BranchAndBound, FacadeReportsProvenGap) {
+  s21::Graph g = RandomGraph(20, 1.0, 100, 69, true);
+  s21::TspExactAlgorithms::BoundedResult result =
+      s21::GraphAlgorithms::SolveTravelingSalesmanProblemWithBound(g, 1);
+  EXPECT_EQ(result.distance,
+            s21::TspExactAlgorithms::HeldKarp(g.adjacency_matrix()).distance);
+  EXPECT_EQ(result.lower_bound, result.distance);
+  EXPECT_EQ(result.gap, 0.0);
+  EXPECT_EQ(s21::GraphAlgorithms::SolveTravelingSalesmanProblem(
+                g, 1, 0, s21::GraphAlgorithms::TspEngine::kBranchAndBound)
+                .distance,
+            result.distance);
+}
+
+TEST(BranchAndBound, FacadeRejectsLargeGraphs) {
+  s21::Graph g = RandomGraph(
+      s21::TspExactAlgorithms::kBranchAndBoundMaxOrder + 1, 1.0, 100, 67);
+  EXPECT_THROW(s21::GraphAlgorithms::SolveTravelingSalesmanProblem(
+                   g, 1, 1, s21::GraphAlgorithms::TspEngine::kBranchAndBound),
+               std::runtime_error);
+}
+
+TEST(LocalSearch, ThreeOptOnDirectedGraph) {
+  s21::Graph g = RandomGraph(150, 1.0, 1000, 66);
+  s21::CandidateLists candidates(g.adjacency_matrix(), 8);
+  s21::TspLocalSearch search(g.adjacency_matrix(), candidates);
+  ASSERT_FALSE(search.symmetric());
+  std::vector<int> tour(150);
+  for (int v = 0; v < 150; v++) tour[v] = v;
+  double before = TourLength(g.adjacency_matrix(), tour);
+  double after = search.ThreeOpt(tour, before);
+  EXPECT_LT(after, before / 2);
+  EXPECT_EQ(after, TourLength(g.adjacency_matrix(), tour));
+  EXPECT_EQ(tour.front(), 0);
+}
+
+TEST(LinKernighan, MatchesHeldKarp) {
+  for (bool symmetric : {true, false}) {
+    s21::Graph g = RandomGraph(18, 1.0, 1000, 67, symmetric);
+    s21::LinKernighanAlgorithms::TsmResult result =
+        s21::LinKernighanAlgorithms::SolveTravelingSalesmanProblem(
+            g.adjacency_matrix(), {}, 1);
+    EXPECT_EQ(result.distance,
+              s21::TspExactAlgorithms::HeldKarp(g.adjacency_matrix()).distance);
+    EXPECT_EQ(TourLength(g.adjacency_matrix(), result.vertices),
+              result.distance);
+    EXPECT_EQ(result.vertices.front(), 0);
+  }
+}
+
+TEST(LinKernighan, SparseGraphs) {
+  s21::Graph sparse = RandomGraph(60, 0.3, 100, 68, true);
+  s21::Matrix<int> adj = sparse.adjacency_matrix();
+  for (int v = 0; v < 60; v++) {
+    adj(v, (v + 1) % 60) = adj((v + 1) % 60, v) = 500;
+  }
+  s21::LinKernighanAlgorithms::TsmResult result =
+      s21::LinKernighanAlgorithms::SolveTravelingSalesmanProblem(adj, {}, 2);
+  ASSERT_EQ(result.vertices.size(), 60);
+  EXPECT_EQ(TourLength(adj, result.vertices), result.distance);
+  EXPECT_LT(result.distance, 60 * 500);
+
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm9.txt");
+  EXPECT_TRUE(s21::LinKernighanAlgorithms::SolveTravelingSalesmanProblem(
+                  g.adjacency_matrix())
+                  .vertices.empty());
+}
+
+TEST(AntColony, StrategiesBuildValidTours) {
+  s21::Graph directed = RandomGraph(30, 0.6, 50, 48);
+  s21::Graph symmetric = RandomGraph(30, 0.6, 50, 49, true);
+  for (s21::AntColonyStrategy strategy :
+       {s21::AntColonyStrategy::kMaxMin,
+        s21::AntColonyStrategy::kColonySystem}) {
+    s21::AntColonyParameters parameters;
+    parameters.strategy = strategy;
+    parameters.restart_after = 3;
+    for (s21::Graph* g : {&directed, &symmetric}) {
+      s21::AntColonyAlgorithms::TsmResult serial =
+          s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+              *g, 20, 1, 4, 1, parameters);
+      s21::AntColonyAlgorithms::TsmResult parallel =
+          s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+              *g, 20, 1, 4, 4, parameters);
+      ASSERT_EQ(serial.vertices.size(), 30);
+      EXPECT_EQ(TourLength(g->adjacency_matrix(), serial.vertices),
+                serial.distance);
+      EXPECT_EQ(serial.vertices, parallel.vertices);
+    }
+  }
+}
+
+TEST(AntColony, StrategiesFindOptimumOfSmallGraph) {
+  s21::Graph g = RandomGraph(12, 1.0, 100, 50, true);
+  double optimum =
+      s21::TspExactAlgorithms::HeldKarp(g.adjacency_matrix()).distance;
+  for (s21::AntColonyStrategy strategy :
+       {s21::AntColonyStrategy::kAntSystem, s21::AntColonyStrategy::kMaxMin,
+        s21::AntColonyStrategy::kColonySystem}) {
+    s21::AntColonyParameters parameters;
+    parameters.strategy = strategy;
+    SCOPED_TRACE(static_cast<int>(strategy));
+    EXPECT_EQ(s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+                  g, 100, 1, 5, 1, parameters)
+                  .distance,
+              optimum);
+  }
+}
+
+TEST(AntColony, IslandsAreReproducible) {
+  s21::Graph g = RandomGraph(40, 0.7, 100, 51, true);
+  s21::AntColonyParameters parameters;
+  parameters.islands = 4;
+  parameters.migration_interval = 3;
+  s21::AntColonyAlgorithms::TsmResult serial =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+          g, 10, 1, 8, 1, parameters);
+  s21::AntColonyAlgorithms::TsmResult parallel =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+          g, 10, 1, 8, 4, parameters);
+  ASSERT_EQ(serial.vertices.size(), 40);
+  EXPECT_EQ(TourLength(g.adjacency_matrix(), serial.vertices),
+            serial.distance);
+  EXPECT_EQ(serial.vertices, parallel.vertices);
+}
+
+TEST(AntColony, IslandsReturnInitialTourWithoutIterations) {
+  s21::Graph g = RandomGraph(20, 1.0, 100, 52, true);
+  s21::AntColonyParameters parameters;
+  parameters.islands = 3;
+  s21::AntColonyAlgorithms::TsmResult result =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+          g, 0, 1, 9, 0, parameters);
+  ASSERT_EQ(result.vertices.size(), 20);
+  EXPECT_EQ(result.distance,
+            s21::TourConstructionAlgorithms::ShortestTour(g.adjacency_matrix())
+                .distance);
+}
+
+TEST(AnytimeTsp, ReportsImprovingToursUntilStagnation) {
+  s21::Graph g = RandomGraph(40, 1.0, 100, 45);
+  std::vector<double> reported;
+  s21::TspSearchControl control;
+  control.stagnation_limit = 5;
+  control.on_improvement = [&](const std::vector<int>& tour, double distance) {
+    EXPECT_EQ(TourLength(g.adjacency_matrix(), tour), distance);
+    reported.push_back(distance);
+  };
+  s21::AntColonyAlgorithms::TsmResult result =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+          g, std::numeric_limits<size_t>::max(), 1, 3, 1, {}, control);
+  ASSERT_FALSE(reported.empty());
+  EXPECT_TRUE(std::is_sorted(reported.rbegin(), reported.rend()));
+  EXPECT_EQ(std::adjacent_find(reported.begin(), reported.end()),
+            reported.end());
+  EXPECT_EQ(reported.back(), result.distance);
+}
+
+TEST(AnytimeTsp, CancelledRunReturnsATour) {
+  s21::Graph g = RandomGraph(30, 1.0, 100, 46);
+  std::atomic<bool> cancel{true};
+  s21::TspSearchControl control;
+  control.cancel = &cancel;
+  s21::AntColonyAlgorithms::TsmResult colony =
+      s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(
+          g, std::numeric_limits<size_t>::max(), 1, 3, 1, {}, control);
+  EXPECT_EQ(TourLength(g.adjacency_matrix(), colony.vertices),
+            colony.distance);
+
+  s21::LinKernighanParameters parameters;
+  parameters.kicks = std::numeric_limits<size_t>::max();
+  s21::LinKernighanAlgorithms::TsmResult kicked =
+      s21::LinKernighanAlgorithms::SolveTravelingSalesmanProblem(
+          g.adjacency_matrix(), parameters, 3, control);
+  EXPECT_EQ(TourLength(g.adjacency_matrix(), kicked.vertices),
+            kicked.distance);
+
+  s21::TspExactAlgorithms::BoundedResult bounded =
+      s21::TspExactAlgorithms::BranchAndBound(
+          g.adjacency_matrix(), colony.vertices, std::chrono::milliseconds(0),
+          1, &cancel);
+  EXPECT_LE(bounded.distance, colony.distance);
+}
+
+TEST(AnytimeTsp, FacadeKeepsToTimeBudget) {
+  s21::Graph g = RandomGraph(300, 1.0, 1000, 47, true);
+  s21::TspSearchControl control;
+  control.time_budget = std::chrono::milliseconds(100);
+  auto start = std::chrono::steady_clock::now();
+  s21::GraphAlgorithms::TsmResult result =
+      s21::GraphAlgorithms::SolveTravelingSalesmanProblem(
+          g, 5, 1, s21::GraphAlgorithms::TspEngine::kLinKernighan, control);
+  auto elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_EQ(TourLength(g.adjacency_matrix(), result.vertices),
+            result.distance);
+  EXPECT_GE(elapsed, control.time_budget);
+  EXPECT_LT(elapsed, std::chrono::seconds(2));
+}
+
+TEST(AnytimeTsp, HeldKarpReportsItsTour) {
+  s21::Graph g = RandomGraph(10, 1.0, 100, 48);
+  std::vector<double> reported;
+  s21::TspSearchControl control;
+  control.on_improvement = [&](const std::vector<int>&, double distance) {
+    reported.push_back(distance);
+  };
+  s21::GraphAlgorithms::TsmResult result =
+      s21::GraphAlgorithms::SolveTravelingSalesmanProblem(
+          g, 5, 1, s21::GraphAlgorithms::TspEngine::kHeldKarp, control);
+  EXPECT_EQ(reported, std::vector<double>{result.distance});
+}
+
+TEST(TourConstruction, ToursAreValid) {
+  s21::Graph directed = RandomGraph(50, 1.0, 100, 52);
+  s21::Graph symmetric = RandomGraph(50, 1.0, 100, 53, true);
+  for (s21::Graph* g : {&directed, &symmetric}) {
+    const s21::Matrix<int>& adj = g->adjacency_matrix();
+    for (const s21::TourConstructionAlgorithms::TsmResult& tour :
+         {s21::TourConstructionAlgorithms::NearestNeighbor(adj),
+          s21::TourConstructionAlgorithms::GreedyEdge(adj),
+          s21::TourConstructionAlgorithms::DoubleTree(adj)}) {
+      ASSERT_EQ(tour.vertices.size(), 50);
+      EXPECT_EQ(tour.vertices.front(), 0);
+      EXPECT_EQ(TourLength(adj, tour.vertices), tour.distance);
+      EXPECT_LE(s21::TourConstructionAlgorithms::ShortestTour(adj).distance,
+                tour.distance);
+    }
+    // Without iterations the colony returns its starting tour.
+    EXPECT_EQ(
+        s21::AntColonyAlgorithms::SolveTravelingSalesmanProblem(*g, 0).distance,
+        s21::TourConstructionAlgorithms::ShortestTour(adj).distance);
+  }
+
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm9.txt");
+  EXPECT_TRUE(
+      s21::TourConstructionAlgorithms::ShortestTour(g.adjacency_matrix())
+          .vertices.empty());
+}
+
+TEST(TourConstruction, DoubleTreeIsWithinTwiceOptimum) {
+  // Manhattan distances between grid points satisfy the triangle inequality.
+  std::mt19937 gen(54);
+  std::uniform_int_distribution<> coordinate(0, 50);
+  std::vector<std::pair<int, int>> points(14);
+  for (auto& point : points) {
+    point = {coordinate(gen), coordinate(gen)};
+  }
+  s21::Matrix<int> adj(14, 14);
+  for (size_t i = 0; i < 14; i++) {
+    for (size_t j = 0; j < 14; j++) {
+      if (i != j) {
+        adj(i, j) = 1 + std::abs(points[i].first - points[j].first) +
+                    std::abs(points[i].second - points[j].second);
+      }
+    }
+  }
+  double optimum = s21::TspExactAlgorithms::HeldKarp(adj).distance;
+  EXPECT_LE(s21::TourConstructionAlgorithms::DoubleTree(adj).distance,
+            2 * optimum);
+}
+
+TEST(AntColony, JumpedStreamsDiffer) {
+  s21::Xoshiro256 first(7);
+  s21::Xoshiro256 second = first;
+  second.Jump();
+  EXPECT_NE(first(), second());
+  double x = first.NextDouble();
+  EXPECT_GE(x, 0.0);
+  EXPECT_LT(x, 1.0);
+}
@@ -39,3 +39,31 @@ TEST(Graph, TestExport_2) {
   f.close();
   EXPECT_EQ(s, "graph");
 }
+
+TEST(Graph, WeightBounds) {
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm2.txt");
+  EXPECT_EQ(g.edges_count(), 6);
+  EXPECT_EQ(g.min_weight(), -5);
+  EXPECT_EQ(g.max_weight(), 5);
+  EXPECT_FALSE(g.HasBoundedWeights(100));
+  g.LoadGraphFromFile("./tests/test_matrices/tm5.txt");
+  EXPECT_TRUE(g.HasBoundedWeights(9));
+  EXPECT_FALSE(g.HasBoundedWeights(8));
+}
+
+TEST(Graph, AdjacencyListFollowsMatrix) {
+  s21::Graph g;
+  g.LoadGraphFromFile("./tests/test_matrices/tm2.txt");
+  const s21::AdjacencyList& list = g.adjacency_list();
+  ASSERT_EQ(list.order(), g.order());
+  EXPECT_EQ(list.edges_count(), g.edges_count());
+  for (size_t i = 0; i < g.order(); i++) {
+    for (const s21::AdjacencyList::Edge& edge : list.neighbors(i)) {
+      EXPECT_EQ(edge.weight, g.adjacency_matrix()(i, edge.to));
+    }
+  }
+  g.LoadGraphFromFile("./tests/test_matrices/tm5.txt");
+  EXPECT_EQ(g.adjacency_list().order(), g.order());
+  EXPECT_EQ(s21::Graph().adjacency_list().order(), 0);
+}
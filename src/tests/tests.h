@@ -4,10 +4,29 @@
 #include <gtest/gtest.h>
 
 #include <fstream>
+#include <random>
 #include <string>
 #include <vector>
 
 #include "../graph/graph.h"
 #include "../graph/graph_algorithms.h"
+#include "../graph/tour_construction.h"
+
+inline s21::Graph RandomGraph(size_t order, double density, int max_weight,
+                              unsigned seed, bool symmetric = false) {
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<> edge(0.0, 1.0);
+  std::uniform_int_distribution<> weight(1, max_weight);
+  s21::Matrix<int> m(order, order);
+  for (size_t i = 0; i < order; i++) {
+    for (size_t j = symmetric ? i + 1 : 0; j < order; j++) {
+      if (i != j && edge(gen) < density) {
+        m(i, j) = weight(gen);
+        if (symmetric) m(j, i) = m(i, j);
+      }
+    }
+  }
+  return s21::Graph(std::move(m));
+}
 
 #endif
\ No newline at end of file